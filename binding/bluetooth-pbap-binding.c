@@ -17,6 +17,7 @@
 
 #define _GNU_SOURCE
 #include <errno.h>
+#include <gio/gio.h>
 #include <glib.h>
 #include <json-c/json.h>
 #include <math.h>
@@ -25,29 +26,413 @@
 #include <string.h>
 #include <sys/time.h>
 #include <time.h>
+#include <unistd.h>
 
 #define AFB_BINDING_VERSION 3
 #include <afb/afb-binding.h>
 
-#include "obex_client1_interface.h"
-#include "obex_session1_interface.h"
-#include "obex_transfer1_interface.h"
-#include "obex_phonebookaccess1_interface.h"
-#include "freedesktop_dbus_properties_interface.h"
-
-static GDBusObjectManager *obj_manager;
-static OrgBluezObexClient1 *client;
-static OrgBluezObexSession1 *session;
-static OrgBluezObexPhonebookAccess1 *phonebook;
-static GHashTable *xfer_queue;
-static GMutex xfer_queue_mutex;
-static GHashTable *xfer_complete;
-static GMutex xfer_complete_mutex;
-static GCond xfer_complete_cond;
-static GMutex connected_mutex;
-static gboolean connected = FALSE;
-static gchar *connected_address = NULL;
-static afb_event_t status_event;
+#include "bluetooth-pbap-cache.h"
+#include "bluetooth-pbap-delta.h"
+#include "bluetooth-pbap-events.h"
+#include "bluetooth-pbap-link.h"
+#include "bluetooth-pbap-loop.h"
+#include "bluetooth-pbap-lru.h"
+#include "bluetooth-pbap-numbers.h"
+#include "bluetooth-pbap-obex.h"
+#include "bluetooth-pbap-vcard.h"
+
+enum session_state {
+	SESSION_DISCONNECTED,
+	SESSION_CONNECTING,
+	SESSION_CONNECTED,
+	SESSION_FAILED,
+};
+
+static const gchar *session_states[] = {
+	[SESSION_DISCONNECTED] = "disconnected",
+	[SESSION_CONNECTING] = "connecting",
+	[SESSION_CONNECTED] = "connected",
+	[SESSION_FAILED] = "failed",
+};
+
+/*
+ * Session being established, only used from the main loop. Each try
+ * has its own cancellable, which D-Bus callbacks use to tell whether
+ * their try is still the current one.
+ */
+struct session_attempt {
+	struct pbap_device *dev;
+	guint tries;
+	guint timer;
+	gchar *spath;
+	GCancellable *cancel;
+};
+
+/*
+ * A PBAP device with its own session, transfers and job queue, so
+ * that devices are synced in parallel. Devices are owned by the main
+ * loop: other threads post messages to it through the mailbox and read
+ * the state of sessions from the status snapshot, keeping addresses
+ * rather than devices. Queued jobs hold a reference until they complete.
+ */
+struct pbap_device {
+	gint ref;
+	gchar *address;
+	enum session_state state;
+	gchar *session;
+	guint phonebook_watch;
+	gchar *folder;
+	gchar *primary_counter;
+	gchar *secondary_counter;
+	GHashTable *xfers;
+	GQueue jobs;
+	struct pbap_job *current_job;
+	struct session_attempt *attempt;
+	GCancellable *cancel;
+	struct json_object *listing;
+	struct json_object *history;
+};
+
+/*
+ * Live objects and session counts, to tell leaks from a soak run of
+ * connects and disconnects with the metrics verb.
+ */
+static struct {
+	gint devices;
+	gint jobs;
+	gint transfers;
+	gint sessions_created;
+	gint sessions_removed;
+} live;
+
+static GHashTable *devices;
+/* device of requests that do not name one, the one connected last */
+static gchar *default_address;
+
+/*
+ * Immutable copy of the state of every session and of the default
+ * device, published by the main loop whenever either changes, so that
+ * verbs never wait for it. Replaced snapshots are freed once no
+ * reader is left.
+ */
+struct device_status {
+	gchar *address;
+	enum session_state state;
+};
+
+struct status_snapshot {
+	gchar *default_address;
+	GArray *devices;	/* struct device_status, the default one first */
+};
+
+static struct status_snapshot *snapshot;
+static gint snapshot_readers;
+static GSList *snapshots_retired;
+static guint snapshot_reclaim_timer;
+
+/* milliseconds between attempts to free replaced snapshots */
+#define SNAPSHOT_RECLAIM_INTERVAL	100
+
+/*
+ * Devices of Bluetooth-Manager by object name, read once with
+ * managed_objects and then kept up to date from device_changes.
+ * Only touched from the main loop.
+ */
+struct bt_device {
+	gchar *address;
+	gboolean connected;
+	gboolean pbap;
+	guint debounce;
+};
+
+static GHashTable *bt_devices;
+
+/* device_changes payload handed to the main loop, -1 if not reported */
+struct bt_change {
+	gchar *device;
+	gchar *action;
+	gchar *address;
+	gint connected;
+	gint pbap;
+};
+static struct pbap_event *status_event;
+static struct pbap_event *contacts_changed_event;
+static struct pbap_event *history_changed_event;
+static struct pbap_event *caller_id_event;
+static struct pbap_event *sync_progress_event;
+
+/*
+ * OBEX operations are serialized through a job queue per device that
+ * is only touched from the main loop thread. A PBAP server can only
+ * handle one operation at a time and Select changes the state used
+ * by the following Pull/PullAll, so two requests must never interleave.
+ */
+enum job_type {
+	JOB_PULL_ALL,
+	JOB_PULL,
+	JOB_SEARCH,
+	JOB_LIST,
+};
+
+/*
+ * Stages run when a device connects, each published as soon as it
+ * completes: the alphabetical listing of contacts, combined call
+ * history, contacts without photos (unless already cached), then all
+ * contacts and the remaining call history lists.
+ */
+enum sync_stage {
+	STAGE_LISTING,
+	STAGE_HISTORY,
+	STAGE_CONTACTS,
+	STAGE_PHOTOS,
+	STAGE_DONE,
+};
+
+static const gchar *stage_names[] = {
+	[STAGE_LISTING] = "listing",
+	[STAGE_HISTORY] = "history",
+	[STAGE_CONTACTS] = "contacts",
+	[STAGE_PHOTOS] = "photos",
+};
+
+struct sync_pipeline {
+	enum sync_stage stage;
+	gint64 started;
+};
+
+/*
+ * Microseconds from session up to the end of each stage of the last
+ * connect, and until the end of STAGE_HISTORY.
+ */
+static struct {
+	GMutex mutex;
+	guint runs;
+	gint64 usable;
+	gint64 usable_total;
+	gint64 stages[STAGE_DONE];
+} pipeline_stats;
+
+/*
+ * Progress of a PullAll, only tracked while sync_progress has
+ * subscribers. Records are counted in the transfer file as it grows.
+ */
+struct sync_progress {
+	gint64 started;
+	gint64 last_push;
+	guint64 bytes;
+	guint64 base_bytes;
+	guint64 total_bytes;
+	guint records;
+	gint total_records;
+	goffset scanned;
+	guint timer;
+};
+
+struct pbap_job {
+	enum job_type type;
+	const gchar *list;
+	gchar *handle;
+	gchar *number;
+	gchar *address;
+	gchar *filename;
+	gchar *data;
+	int max_entries;
+	afb_req_t request;
+	const char *info;
+	void (*complete)(struct pbap_job *job, struct json_object *result,
+			 const char *error);
+	struct sync_progress *progress;
+	struct sync_pipeline *pipeline;
+	gboolean skip_photos;
+	gboolean admitted;
+	struct pbap_client *client;
+	GSList *joined;
+	struct pbap_job *leader;
+	gint64 deadline;
+	guint watchdog;
+	gboolean timed_out;
+	guint chunk;
+	guint skip;
+	gint64 window_started;
+	gint64 window_active;
+	gint64 window_ended;
+	struct json_object *window;
+	guint window_count;
+	gsize window_offset;
+	struct pbap_device *dev;
+};
+
+/*
+ * Seconds a job may take from being queued, per verb, 0 for no limit.
+ * Requests may set their own "timeout". A job past its deadline fails,
+ * cancelling its transfer if one is running. Background jobs have no
+ * deadline, requests joining them have their own.
+ */
+#define TIMEOUT_CONTACTS_DEFAULT	300
+#define TIMEOUT_HISTORY_DEFAULT		60
+#define TIMEOUT_ENTRY_DEFAULT		15
+#define TIMEOUT_SEARCH_DEFAULT		15
+#define TIMEOUT_LISTING_DEFAULT		15
+
+static struct {
+	gint64 contacts;
+	gint64 history;
+	gint64 entry;
+	gint64 search;
+	gint64 listing;
+} timeouts = {
+	.contacts = TIMEOUT_CONTACTS_DEFAULT,
+	.history = TIMEOUT_HISTORY_DEFAULT,
+	.entry = TIMEOUT_ENTRY_DEFAULT,
+	.search = TIMEOUT_SEARCH_DEFAULT,
+	.listing = TIMEOUT_LISTING_DEFAULT,
+};
+
+/*
+ * Client session of a request, attached with afb_req_context and
+ * counting the requests it has admitted. Jobs hold a reference, so
+ * the session may close while they run.
+ */
+struct pbap_client {
+	gint ref;
+	gint pending;
+};
+
+/*
+ * Requests with a client waiting are admitted up to a number per
+ * device, queued or running, and per client session. Further ones
+ * are rejected right away rather than queued behind a slow phone.
+ * Background jobs are not counted.
+ */
+#define QUEUE_DEPTH_DEFAULT	16
+#define QUEUE_CLIENT_DEFAULT	4
+
+static gint64 queue_depth = QUEUE_DEPTH_DEFAULT;
+static gint64 queue_client = QUEUE_CLIENT_DEFAULT;
+
+static struct {
+	GMutex mutex;
+	GHashTable *depths;
+	guint admitted;
+	guint rejected;
+	guint rejected_client;
+	guint coalesced;
+	guint timeouts;
+	guint cancelled;
+} queue_stats;
+
+/* minimum milliseconds between sync_progress events of a transfer */
+#define PROGRESS_INTERVAL	500
+#define PROGRESS_CHUNK		8192
+#define VCARD_END		"END:VCARD"
+
+static gint progress_listeners;
+
+/* threads reading, indexing and serializing vCards off the main loop */
+#define LOOP_WORKERS_DEFAULT	2
+
+static gint64 loop_workers = LOOP_WORKERS_DEFAULT;
+
+/*
+ * Full contacts syncs are pulled in windows, each appended to a
+ * checkpoint of the list once received. A sync cut short by a
+ * disconnect, timeout or failed transfer resumes from the first
+ * missing window, unless the phonebook changed or the checkpoint is
+ * older than max_age seconds. A chunk of 0 pulls everything at once.
+ * Lists asked for more entries than MaxCount allows are always paged.
+ *
+ * The first window of a device has chunk entries, later ones are
+ * sized from its measured speed to take about latency milliseconds,
+ * or stay at chunk entries with a latency of 0.
+ */
+#define SYNC_CHUNK_DEFAULT		500
+#define SYNC_LATENCY_DEFAULT		2000
+#define SYNC_CHECKPOINT_AGE_DEFAULT	3600
+
+static gint64 sync_chunk = SYNC_CHUNK_DEFAULT;
+static gint64 sync_latency = SYNC_LATENCY_DEFAULT;
+static gint64 sync_checkpoint_age = SYNC_CHECKPOINT_AGE_DEFAULT;
+
+struct sync_checkpoint {
+	GString *data;
+	guint count;
+	gint64 updated;
+};
+
+/* entry key of the list to checkpoint, only touched from the main loop thread */
+static GHashTable *checkpoints;
+
+/*
+ * MaxCount and Offset are 16 bit. Once entries past the largest Offset
+ * are needed, a last window pulls MaxCount entries from there and those
+ * already received are dropped, so entries up to twice that are reached
+ * and the ones past PBAP_MAX_PAGED are left out with a warning.
+ */
+#define PBAP_MAX_COUNT	G_MAXUINT16
+#define PBAP_MAX_PAGED	(2 * PBAP_MAX_COUNT)
+
+#define CONFIG_FILE	"/etc/xdg/AGL/bluetooth-pbap.conf"
+
+/*
+ * Seconds allowed to set up a session, and retries after the first
+ * try, the first one after SESSION_BACKOFF seconds and each further
+ * one twice as late, up to SESSION_BACKOFF_MAX.
+ */
+#define SESSION_TIMEOUT_DEFAULT	10
+#define SESSION_RETRIES_DEFAULT	4
+#define SESSION_BACKOFF_DEFAULT	1
+#define SESSION_BACKOFF_MAX	60
+
+/* milliseconds a device must stay connected before a session is set up */
+#define SESSION_DEBOUNCE_DEFAULT	500
+
+static gint64 session_timeout = SESSION_TIMEOUT_DEFAULT;
+static gint64 session_retries = SESSION_RETRIES_DEFAULT;
+static gint64 session_backoff = SESSION_BACKOFF_DEFAULT;
+static gint64 session_debounce = SESSION_DEBOUNCE_DEFAULT;
+
+/* seconds before cached contacts are refreshed in the background */
+#define CACHE_MAX_AGE_DEFAULT	300
+
+/* bytes of contacts kept across all devices, in memory and persisted */
+#define MEMORY_BUDGET_DEFAULT	(16 * 1024 * 1024)
+#define DISK_BUDGET_DEFAULT	(64 * 1024 * 1024)
+
+/* seconds a persistence write is held back to coalesce later ones */
+#define WRITE_DELAY_DEFAULT	5
+
+static struct pbap_cache_config cache_config = {
+	.max_age = CACHE_MAX_AGE_DEFAULT,
+	.write_delay = WRITE_DELAY_DEFAULT,
+	.memory_budget = MEMORY_BUDGET_DEFAULT,
+	.disk_budget = DISK_BUDGET_DEFAULT,
+	.codec = PBAP_CODEC_ZLIB,
+};
+
+/*
+ * Incoming call event of a telephony binding resolved to caller_id
+ * events, disabled with an empty API name. Off unless configured, as
+ * the API must also be required by the widget.
+ */
+#define CALLER_ID_API_DEFAULT	""
+#define CALLER_ID_EVENT_DEFAULT	"incomingCall"
+
+static gchar *caller_id_api;
+static gchar *caller_id_source;
+
+/*
+ * Individual vCards keyed by "address/list/handle", filled by entry
+ * lookups and from complete PullAll results. Version counters and the
+ * database identifier last seen per "address/list/" and "address/"
+ * are used to drop entries the phone reports as changed.
+ */
+#define ENTRY_CACHE_SIZE_DEFAULT	256
+#define ENTRY_CACHE_BYTES_DEFAULT	(4 * 1024 * 1024)
+
+static gint64 entry_cache_size = ENTRY_CACHE_SIZE_DEFAULT;
+static gint64 entry_cache_bytes = ENTRY_CACHE_BYTES_DEFAULT;
+static struct pbap_lru *entry_cache;
+static GHashTable *folder_versions;
 
 #define PBAP_UUID	"0000112f-0000-1000-8000-00805f9b34fb"
 
@@ -63,254 +448,1841 @@ static afb_event_t status_event;
 #define MISSED		"mch"
 
 
-static int update_or_insert(const char *key, const char *value)
+static void scheduler_run_next(struct pbap_device *dev);
+
+/* the snapshot stays valid until snapshot_release() */
+static const struct status_snapshot *snapshot_acquire(void)
 {
-	json_object *query = json_object_new_object();
-	int ret;
+	g_atomic_int_inc(&snapshot_readers);
 
-	json_object_object_add(query, "key", json_object_new_string(key));
-	json_object_object_add(query, "value", json_object_new_string(value));
-	json_object_get(query);
+	return g_atomic_pointer_get(&snapshot);
+}
 
-	ret = afb_service_call_sync("persistence", "update", query, NULL, NULL, NULL);
-	if (!ret) {
-		AFB_DEBUG("Updating persistence value '%s'", key);
-		json_object_put(query);
-		return 0;
+static void snapshot_release(void)
+{
+	g_atomic_int_add(&snapshot_readers, -1);
+}
+
+static const struct device_status *snapshot_find(const struct status_snapshot *snap,
+						 const gchar *address)
+{
+	int i;
+
+	for (i = 0; address && i < snap->devices->len; i++) {
+		struct device_status *ds = &g_array_index(snap->devices,
+							  struct device_status, i);
+
+		if (!g_strcmp0(ds->address, address))
+			return ds;
 	}
 
-	ret = afb_service_call_sync("persistence", "write", query, NULL, NULL, NULL);
-	if (!ret) {
-		AFB_DEBUG("Create persistence value '%s'", key);
-		return 0;
+	return NULL;
+}
+
+static void snapshot_free(gpointer data)
+{
+	struct status_snapshot *snap = data;
+	int i;
+
+	for (i = 0; i < snap->devices->len; i++)
+		g_free(g_array_index(snap->devices, struct device_status, i).address);
+	g_array_free(snap->devices, TRUE);
+	g_free(snap->default_address);
+	g_free(snap);
+}
+
+/*
+ * A reader counted after the snapshot was replaced can only have
+ * loaded its successor, so retired ones go once none is counted.
+ */
+static gboolean snapshot_reclaim_cb(gpointer user_data)
+{
+	if (g_atomic_int_get(&snapshot_readers))
+		return G_SOURCE_CONTINUE;
+
+	g_slist_free_full(snapshots_retired, snapshot_free);
+	snapshots_retired = NULL;
+	snapshot_reclaim_timer = 0;
+
+	return G_SOURCE_REMOVE;
+}
+
+/* publish the sessions of the devices table, only from the main loop */
+static void snapshot_publish(void)
+{
+	struct status_snapshot *snap = g_new0(struct status_snapshot, 1), *old;
+	struct device_status ds;
+	struct pbap_device *dev;
+	GHashTableIter iter;
+
+	snap->default_address = g_strdup(default_address);
+	snap->devices = g_array_new(FALSE, FALSE, sizeof(struct device_status));
+
+	g_hash_table_iter_init(&iter, devices);
+	while (g_hash_table_iter_next(&iter, NULL, (gpointer *) &dev)) {
+		ds.address = g_strdup(dev->address);
+		ds.state = dev->state;
+		if (g_strcmp0(dev->address, default_address))
+			g_array_append_val(snap->devices, ds);
+		else
+			g_array_prepend_val(snap->devices, ds);
 	}
 
-	return ret;
+	old = g_atomic_pointer_get(&snapshot);
+	g_atomic_pointer_set(&snapshot, snap);
+	if (!old)
+		return;
+
+	snapshots_retired = g_slist_prepend(snapshots_retired, old);
+	if (!snapshot_reclaim_timer && snapshot_reclaim_cb(NULL))
+		snapshot_reclaim_timer = pbap_loop_timeout_add(SNAPSHOT_RECLAIM_INTERVAL,
+						       snapshot_reclaim_cb, NULL);
 }
 
-static int read_cached_value(const char *key, const char **data)
+static struct pbap_device *device_new(const gchar *address)
 {
-	json_object *response, *query;
-	int ret;
+	struct pbap_device *dev = g_new0(struct pbap_device, 1);
 
-	query = json_object_new_object();
-	json_object_object_add(query, "key", json_object_new_string(key));
+	dev->ref = 1;
+	dev->address = g_strdup(address);
+	dev->state = SESSION_DISCONNECTED;
+	dev->xfers = g_hash_table_new_full(g_str_hash, g_str_equal, g_free, NULL);
+	g_queue_init(&dev->jobs);
+	dev->cancel = g_cancellable_new();
+	g_atomic_int_inc(&live.devices);
 
-	ret = afb_service_call_sync("persistence", "read", query, &response, NULL, NULL);
-	if (!ret) {
-		json_object *val = NULL;
+	return dev;
+}
+
+static struct pbap_device *device_ref(struct pbap_device *dev)
+{
+	dev->ref++;
+
+	return dev;
+}
+
+static void device_unref(struct pbap_device *dev)
+{
+	if (--dev->ref)
+		return;
+
+	g_free(dev->session);
+	g_free(dev->folder);
+	g_free(dev->primary_counter);
+	g_free(dev->secondary_counter);
+	g_object_unref(dev->cancel);
+	json_object_put(dev->listing);
+	json_object_put(dev->history);
+	g_hash_table_unref(dev->xfers);
+	g_free(dev->address);
+	g_free(dev);
+	g_atomic_int_add(&live.devices, -1);
+}
+
+/* jobs of a device that went away fail with a clearer error */
+static const char *device_error(struct pbap_device *dev, const char *error)
+{
+	return dev->state == SESSION_DISCONNECTED ? "device disconnected" : error;
+}
+
+static void *client_new(void *closure)
+{
+	struct pbap_client *client = g_new0(struct pbap_client, 1);
+
+	client->ref = 1;
+
+	return client;
+}
 
-		json_object_object_get_ex(response, "value", &val);
-		if (!val)
-			return -EINVAL;
+static void client_unref(void *data)
+{
+	struct pbap_client *client = data;
+
+	if (g_atomic_int_dec_and_test(&client->ref))
+		g_free(client);
+}
+
+/* returns NULL if admitted, or the error to fail the request with */
+static const char *queue_admit(struct pbap_job *job)
+{
+	struct pbap_client *client;
+	gint depth;
+
+	client = afb_req_context(job->request, 0, client_new, client_unref, NULL);
+	if (client && queue_client &&
+	    g_atomic_int_add(&client->pending, 1) >= queue_client) {
+		g_atomic_int_add(&client->pending, -1);
+		g_mutex_lock(&queue_stats.mutex);
+		queue_stats.rejected_client++;
+		g_mutex_unlock(&queue_stats.mutex);
+		return "too many requests";
+	}
 
-		*data = g_strdup(json_object_get_string(val));
+	/* released along with the job, admitted or not */
+	if (client) {
+		g_atomic_int_inc(&client->ref);
+		job->client = client;
 	}
 
-	json_object_get(response);
+	g_mutex_lock(&queue_stats.mutex);
+	depth = GPOINTER_TO_INT(g_hash_table_lookup(queue_stats.depths, job->address));
+	if (queue_depth && depth >= queue_depth) {
+		queue_stats.rejected++;
+		g_mutex_unlock(&queue_stats.mutex);
+		return "queue full";
+	}
 
-	return ret;
+	g_hash_table_replace(queue_stats.depths, g_strdup(job->address),
+			     GINT_TO_POINTER(depth + 1));
+	job->admitted = TRUE;
+	queue_stats.admitted++;
+	g_mutex_unlock(&queue_stats.mutex);
+
+	return NULL;
 }
 
-static void on_interface_proxy_properties_changed(
-		GDBusObjectManagerClient *manager,
-		GDBusObjectProxy *object_proxy,
-		GDBusProxy *interface_proxy,
-		GVariant *changed_properties,
-		const gchar *const *invalidated_properties,
-		gpointer user_data)
+static void queue_release(struct pbap_job *job)
 {
-	GVariantIter iter;
-	const gchar *key;
-	GVariant *value;
-	gchar *filename;
+	gint depth;
 
-	const gchar *path = g_dbus_object_get_object_path(G_DBUS_OBJECT(object_proxy));
+	if (job->client) {
+		g_atomic_int_add(&job->client->pending, -1);
+		client_unref(job->client);
+	}
 
-	if ((filename = g_hash_table_lookup(xfer_queue, path))) {
-		g_variant_iter_init(&iter, changed_properties);
-		while (g_variant_iter_next(&iter, "{&sv}", &key, &value)) {
-			const gchar *val = NULL;
+	if (!job->admitted)
+		return;
+
+	g_mutex_lock(&queue_stats.mutex);
+	depth = GPOINTER_TO_INT(g_hash_table_lookup(queue_stats.depths, job->address));
+	if (depth > 1)
+		g_hash_table_replace(queue_stats.depths, g_strdup(job->address),
+				     GINT_TO_POINTER(depth - 1));
+	else
+		g_hash_table_remove(queue_stats.depths, job->address);
+	g_mutex_unlock(&queue_stats.mutex);
+}
+
+static void free_job(struct pbap_job *job)
+{
+	queue_release(job);
+	if (job->watchdog)
+		pbap_loop_source_remove(job->watchdog);
+	g_free(job->handle);
+	g_free(job->number);
+	g_free(job->address);
+	g_free(job->filename);
+	g_free(job->data);
+	if (job->progress && job->progress->timer)
+		pbap_loop_source_remove(job->progress->timer);
+	g_free(job->progress);
+	g_free(job->pipeline);
+	if (job->chunk)
+		pbap_link_save();
+	if (job->dev)
+		device_unref(job->dev);
+	g_free(job);
+	g_atomic_int_add(&live.jobs, -1);
+}
 
-			if (g_strcmp0(key, "Status"))
-				continue;
+static void job_reply(struct pbap_job *job, struct json_object *result,
+		      const char *error)
+{
+	if (!job->request) {
+		json_object_put(result);
+		return;
+	}
 
-			val = g_variant_get_string(value, NULL);
+	if (error)
+		afb_req_fail(job->request, error, NULL);
+	else
+		afb_req_success(job->request, result, job->info);
 
-			if (g_strcmp0(val, "complete") && g_strcmp0(val, "error"))
-				continue;
+	afb_req_unref(job->request);
+}
 
-			g_mutex_lock(&xfer_complete_mutex);
-			g_hash_table_insert(xfer_complete, g_strdup(path),
-				g_strdup(!g_strcmp0(val, "complete") ? filename : ""));
-			g_cond_signal(&xfer_complete_cond);
-			g_mutex_unlock(&xfer_complete_mutex);
-			g_mutex_lock(&xfer_queue_mutex);
-			g_hash_table_remove(xfer_queue, path);
-			g_mutex_unlock(&xfer_queue_mutex);
-		}
+static struct pbap_job *job_new(const gchar *address, enum job_type type,
+				const gchar *list, int max_entries,
+				afb_req_t request, const char *info)
+{
+	struct pbap_job *job = g_new0(struct pbap_job, 1);
+
+	g_atomic_int_inc(&live.jobs);
+	job->address = g_strdup(address);
+	job->type = type;
+	job->list = list;
+	job->max_entries = max_entries;
+	job->info = info;
+	job->complete = job_reply;
+	if (request)
+		job->request = afb_req_addref(request);
+
+	return job;
+}
+
+/* answer the requests that joined a job, each with a copy, then the job */
+static void job_complete(struct pbap_job *job, struct json_object *result,
+			 const char *error)
+{
+	struct json_object *copy;
+	struct pbap_job *other;
+	GSList *l;
+
+	for (l = job->joined; l; l = l->next) {
+		other = l->data;
+		copy = NULL;
+		if (result)
+			json_object_deep_copy(result, &copy, NULL);
+		other->complete(other, copy, error);
+		free_job(other);
 	}
+	g_slist_free(job->joined);
+	job->joined = NULL;
+
+	if (job->complete)
+		job->complete(job, result, error);
+	else
+		json_object_put(result);
+	job->complete = NULL;
+}
+
+static void job_finish(struct pbap_job *job, struct json_object *result,
+		       const char *error)
+{
+	struct pbap_device *dev = device_ref(job->dev);
+
+	if (dev->current_job == job)
+		dev->current_job = NULL;
+
+	if (error)
+		error = device_error(dev, error);
+	if (error && job->timed_out)
+		error = "timeout";
+	job_complete(job, result, error);
+	free_job(job);
+
+	scheduler_run_next(dev);
+	device_unref(dev);
 }
 
+/* read from a worker, the transfer file is removed whatever the outcome */
 static json_object *get_vcard_xfer(gchar *filename)
 {
-	FILE *fp;
-	json_object *vcard_str;
+	json_object *vcard_str = NULL;
+	GError *error = NULL;
 	gchar *vcard_data;
-	size_t size, n;
-
-	fp = fopen(filename, "ro");
-	fseek(fp, 0L, SEEK_END);
-	size = ftell(fp);
-	vcard_data = calloc(1, size);
-	fseek(fp, 0L, SEEK_SET);
-	n = fread(vcard_data, 1, size, fp);
-	if (n != size) {
-		AFB_ERROR("Read only %ld/%ld bytes from %s", n, size, filename);
-		return NULL;
+
+	if (g_file_get_contents(filename, &vcard_data, NULL, &error)) {
+		vcard_str = json_object_new_string(vcard_data);
+		g_free(vcard_data);
+	} else {
+		AFB_ERROR("Cannot read %s: %s", filename, error->message);
+		g_error_free(error);
 	}
 
-	vcard_str = json_object_new_string(vcard_data);
-	free(vcard_data);
-	fclose(fp);
 	unlink(filename);
 
 	return vcard_str;
 }
 
-static void get_filename(gchar *filename)
+static const char *job_error(struct pbap_job *job)
 {
-	struct tm* tm_info;;
-	struct timeval tv;
-	long ms;
-	gchar buffer[64];
+	return job->type == JOB_PULL ? "invalid handle" : "transfer failed";
+}
 
-	gettimeofday(&tv, NULL);
+static gchar *entry_key(const gchar *address, const gchar *list,
+		        const gchar *handle)
+{
+	return g_strdup_printf("%s/%s/%s", address, list, handle ? handle : "");
+}
 
-	ms = lrint((double)tv.tv_usec/1000.0);
-	if (ms >= 1000) {
-		ms -=1000;
-		tv.tv_sec++;
-	}
-	tm_info = localtime(&tv.tv_sec);
+/* handles of the listing in transfer order, or NULL if they do not match */
+static GPtrArray *listing_handles(GVariant *listing, guint count)
+{
+	const gchar *handle, *name;
+	GPtrArray *handles;
+	GVariantIter iter;
 
-	strftime(buffer, 26, "%Y%m%d%H%M%S", tm_info);
+	if (!listing || g_variant_n_children(listing) != count)
+		return NULL;
+
+	handles = g_ptr_array_new_with_free_func(g_free);
+	g_variant_iter_init(&iter, listing);
+	while (g_variant_iter_next(&iter, "(&s&s)", &handle, &name))
+		g_ptr_array_add(handles, g_strdup(handle));
 
-	sprintf(filename, "/tmp/vcard-%s%03ld.dat", buffer, ms);
+	return handles;
 }
 
-static gchar *pull_vcard(const gchar *handle)
+/* map a complete indexed PullAll to the handles of the listing */
+static void entry_cache_fill(const gchar *address, const gchar *list,
+			     GPtrArray *cards, GPtrArray *handles)
 {
-	GVariantBuilder *b;
-	GVariant *filter, *properties;
-	gchar filename[256];
-	gchar *tpath;
-
-	b = g_variant_builder_new (G_VARIANT_TYPE ("a{sv}"));
-	g_variant_builder_add(b, "{sv}", "Format", g_variant_new_string("vcard30"));
-	filter = g_variant_builder_end(b);
-
-	get_filename(filename);
-	org_bluez_obex_phonebook_access1_call_pull_sync(
-			phonebook, handle, filename, filter, &tpath, &properties, NULL, NULL);
+	gchar *key;
+	guint i;
 
-	g_variant_builder_unref(b);
-	g_mutex_lock(&xfer_queue_mutex);
-	g_hash_table_insert(xfer_queue, g_strdup(tpath), g_strdup(filename));
-	g_mutex_unlock(&xfer_queue_mutex);
+	/* entries are refreshed in place, the phone changing the list drops them */
+	if (!handles) {
+		AFB_DEBUG("%s listing does not match its %u vCards", list, cards->len);
+		return;
+	}
 
-	return tpath;
+	for (i = 0; i < cards->len; i++) {
+		key = entry_key(address, list, g_ptr_array_index(handles, i));
+		pbap_lru_prefill(entry_cache, key, g_ptr_array_index(cards, i));
+		g_free(key);
+	}
 }
 
-static json_object *get_vcard(const gchar *handle)
+/*
+ * Push what changed in a complete list since it was last fetched.
+ * Contacts are tracked by handle and call history by record.
+ */
+static void changes_notify(const gchar *address, const gchar *list,
+			   GPtrArray *cards, GPtrArray *handles)
 {
-	json_object *vcard_str = NULL, *vcard = NULL;
-	gchar *tpath, *filename;
+	gboolean contacts = !g_strcmp0(list, CONTACTS);
+	struct json_object *delta;
+	gchar *key;
 
-	tpath = pull_vcard(handle);
+	key = entry_key(address, list, NULL);
+	delta = pbap_delta_update(key, cards, contacts ? handles : NULL);
+	g_free(key);
 
-	g_mutex_lock(&xfer_complete_mutex);
-	while (!(filename = g_hash_table_lookup(xfer_complete, tpath)))
-		g_cond_wait(&xfer_complete_cond, &xfer_complete_mutex);
+	if (!delta)
+		return;
 
-	if (strlen(filename) > 0)
-		vcard_str = get_vcard_xfer(filename);
+	json_object_object_add(delta, "address", json_object_new_string(address));
+	json_object_object_add(delta, "list", json_object_new_string(list));
+	pbap_event_push(contacts ? contacts_changed_event : history_changed_event,
+		       delta);
+}
 
-	g_hash_table_remove(xfer_complete, tpath);
-	g_free(filename);
-	g_mutex_unlock(&xfer_complete_mutex);
+/*
+ * Contacts indexed by number without their handles, so that callers are
+ * known before the listing for a complete PullAll has been fetched.
+ */
+struct numbers_task {
+	gchar *address;
+	gchar *vcards;
+};
 
-	if (vcard_str) {
-		vcard = json_object_new_object();
-		json_object_object_add(vcard, "vcard", vcard_str);
+static void numbers_index_work(gpointer data)
+{
+	struct numbers_task *task = data;
+	struct json_object *cached = NULL, *jvcards = NULL;
+	gboolean stale;
+	GPtrArray *cards;
+
+	if (task->vcards) {
+		cards = pbap_vcard_split(task->vcards);
+		pbap_numbers_update(task->address, cards, NULL);
+		g_ptr_array_unref(cards);
+	} else {
+		cached = pbap_cache_lookup(task->address, &stale);
+		if (cached && json_object_object_get_ex(cached, "vcards", &jvcards)) {
+			cards = pbap_vcard_split(json_object_get_string(jvcards));
+			pbap_numbers_seed(task->address, cards);
+			g_ptr_array_unref(cards);
+		}
+		json_object_put(cached);
 	}
 
-	return vcard;
+	g_free(task->vcards);
+	g_free(task->address);
+	g_free(task);
 }
 
-static gchar *pull_vcards(int max_entries)
+/* index the vCards of a PullAll, or the cached contacts if vcards is NULL */
+static void numbers_index_async(const gchar *address, const gchar *vcards)
 {
-	GVariantBuilder *b;
-	GVariant *filter, *properties;
-	gchar filename[256];
-	gchar *tpath;
-
-	b = g_variant_builder_new (G_VARIANT_TYPE ("a{sv}"));
-	g_variant_builder_add(b, "{sv}", "Format", g_variant_new_string("vcard30"));
-	g_variant_builder_add(b, "{sv}", "Order", g_variant_new_string("indexed"));
-	g_variant_builder_add(b, "{sv}", "Offset", g_variant_new_uint16(0));
-	if (max_entries >= 0)
-		g_variant_builder_add(b, "{sv}", "MaxCount", g_variant_new_uint16((guint16)max_entries));
-	filter = g_variant_builder_end(b);
+	struct numbers_task *task = g_new0(struct numbers_task, 1);
 
-	get_filename(filename);
-	org_bluez_obex_phonebook_access1_call_pull_all_sync(
-			phonebook, filename, filter, &tpath, &properties, NULL, NULL);
-	g_variant_builder_unref(b);
-	g_mutex_lock(&xfer_queue_mutex);
-	g_hash_table_insert(xfer_queue, g_strdup(tpath), g_strdup(filename));
-	g_mutex_unlock(&xfer_queue_mutex);
+	task->address = g_strdup(address);
+	task->vcards = g_strdup(vcards);
 
-	return tpath;
+	pbap_loop_work(numbers_index_work, NULL, task);
 }
 
-static json_object *get_vcards(int max_entries)
+/* a listing fetched after a PullAll, indexed from a worker */
+struct list_index {
+	struct pbap_job *job;
+	GVariant *listing;
+};
+
+static void list_index_work(gpointer data)
 {
-	json_object *vcards_str, *vcards;
-	gchar *tpath, *filename;
+	struct list_index *index = data;
+	struct pbap_job *job = index->job;
+	GPtrArray *cards, *handles;
 
-	tpath = pull_vcards(max_entries);
-	g_mutex_lock(&xfer_complete_mutex);
-	while (!(filename = g_hash_table_lookup(xfer_complete, tpath)))
-		g_cond_wait(&xfer_complete_cond, &xfer_complete_mutex);
+	cards = pbap_vcard_split(job->data);
+	handles = listing_handles(index->listing, cards->len);
 
-	vcards_str = get_vcard_xfer(filename);
+	entry_cache_fill(job->address, job->list, cards, handles);
 
-	g_hash_table_remove(xfer_complete, tpath);
-	g_mutex_unlock(&xfer_complete_mutex);
+	if (!g_strcmp0(job->list, CONTACTS))
+		pbap_numbers_update(job->address, cards, handles);
 
-	vcards = json_object_new_object();
-	json_object_object_add(vcards, "vcards", vcards_str);
+	/* contacts are compared by handle, made up ones would not match */
+	if (handles || g_strcmp0(job->list, CONTACTS))
+		changes_notify(job->address, job->list, cards, handles);
 
-	return vcards;
+	if (handles)
+		g_ptr_array_unref(handles);
+	g_ptr_array_unref(cards);
 }
 
-static gboolean parse_list_parameter(afb_req_t request, gchar **list)
+static gboolean list_index_done(gpointer data)
 {
-	struct json_object *list_obj, *query;
-	const gchar *list_str;
+	struct list_index *index = data;
 
-	query = afb_req_json(request);
+	if (index->listing)
+		g_variant_unref(index->listing);
+	job_finish(index->job, NULL, NULL);
+	g_free(index);
 
-	if (json_object_object_get_ex(query, "list", &list_obj) == TRUE) {
-		if (json_object_is_type(list_obj, json_type_string)) {
-			list_str = json_object_get_string(list_obj);
-			if (!g_strcmp0(list_str, COMBINED)) {
-				*list = COMBINED;
-			} else if (!g_strcmp0(list_str, INCOMING)) {
-				*list = INCOMING;
-			} else if (!g_strcmp0(list_str, OUTGOING)) {
-				*list = OUTGOING;
+	return G_SOURCE_REMOVE;
+}
+
+/*
+ * Without the listing of the same session the vCards cannot be told
+ * apart by handle, so nothing is indexed and no change is reported.
+ */
+static void list_cb(GObject *source, GAsyncResult *res, gpointer user_data)
+{
+	struct pbap_job *job = user_data;
+	struct list_index *index;
+	GVariant *listing = NULL;
+	GError *error = NULL;
+
+	if (!pbap_obex_list_finish(res, &listing, &error)) {
+		AFB_ERROR("Failed to list %s: %s", job->list, error->message);
+		g_error_free(error);
+		job_finish(job, NULL, NULL);
+		return;
+	}
+
+	if (job->dev->state != SESSION_CONNECTED ||
+	    g_hash_table_lookup(devices, job->address) != job->dev) {
+		AFB_DEBUG("Session of %s gone, %s not indexed", job->address, job->list);
+		g_variant_unref(listing);
+		job_finish(job, NULL, NULL);
+		return;
+	}
+
+	index = g_new0(struct list_index, 1);
+	index->job = job;
+	index->listing = listing;
+	pbap_loop_work(list_index_work, list_index_done, index);
+}
+
+static void list_vcards(struct pbap_job *job)
+{
+	GVariantBuilder *b;
+	GVariant *filter;
+
+	b = g_variant_builder_new (G_VARIANT_TYPE ("a{sv}"));
+	g_variant_builder_add(b, "{sv}", "Order", g_variant_new_string("indexed"));
+	filter = g_variant_builder_end(b);
+
+	pbap_obex_list(job->dev->session, filter, job->dev->cancel,
+		       list_cb, job);
+
+	g_variant_builder_unref(b);
+}
+
+static void listing_cb(GObject *source, GAsyncResult *res, gpointer user_data)
+{
+	struct json_object *listing, *entry, *jresp;
+	struct pbap_job *job = user_data;
+	const gchar *handle, *name;
+	GVariant *results = NULL;
+	GError *error = NULL;
+	GVariantIter iter;
+
+	if (!pbap_obex_list_finish(res, &results, &error)) {
+		AFB_ERROR("Failed to list %s: %s", job->list, error->message);
+		g_error_free(error);
+		job_finish(job, NULL, "list failed");
+		return;
+	}
+
+	listing = json_object_new_array();
+	g_variant_iter_init(&iter, results);
+	while (g_variant_iter_next(&iter, "(&s&s)", &handle, &name)) {
+		entry = json_object_new_object();
+		json_object_object_add(entry, "handle", json_object_new_string(handle));
+		json_object_object_add(entry, "name", json_object_new_string(name));
+		json_object_array_add(listing, entry);
+	}
+	g_variant_unref(results);
+
+	jresp = json_object_new_object();
+	json_object_object_add(jresp, "listing", listing);
+
+	job_finish(job, jresp, NULL);
+}
+
+/* handles and names only, enough to show the phonebook right away */
+static void list_entries(struct pbap_job *job)
+{
+	GVariantBuilder *b;
+	GVariant *filter;
+
+	b = g_variant_builder_new (G_VARIANT_TYPE ("a{sv}"));
+	g_variant_builder_add(b, "{sv}", "Order", g_variant_new_string("alphabetical"));
+	filter = g_variant_builder_end(b);
+
+	pbap_obex_list(job->dev->session, filter, job->dev->cancel,
+		       listing_cb, job);
+
+	g_variant_builder_unref(b);
+}
+
+/* count the vCards written to the transfer file since the last scan */
+static void progress_scan(struct pbap_job *job)
+{
+	struct sync_progress *p = job->progress;
+	const gsize len = strlen(VCARD_END);
+	gchar buf[PROGRESS_CHUNK];
+	const gchar *pos, *match;
+	goffset start;
+	size_t n;
+	FILE *f;
+
+	f = fopen(job->filename, "rb");
+	if (!f)
+		return;
+
+	start = MAX(p->scanned - (goffset) (len - 1), 0);
+	while (!fseeko(f, start, SEEK_SET) &&
+	       (n = fread(buf, 1, sizeof(buf), f)) >= len) {
+		for (pos = buf; (match = memmem(pos, buf + n - pos, VCARD_END, len));
+		     pos = match + len) {
+			if (start + (match - buf) + len > p->scanned)
+				p->records++;
+		}
+
+		p->scanned = start + n;
+		if (n < sizeof(buf))
+			break;
+		start = p->scanned - (len - 1);
+	}
+
+	fclose(f);
+}
+
+/* seconds left at the average rate so far, or -1 if unknown */
+static gint64 progress_eta(struct sync_progress *p, gint64 now)
+{
+	gdouble elapsed = (gdouble) (now - p->started) / G_USEC_PER_SEC;
+
+	if (p->total_bytes && p->bytes)
+		return (p->total_bytes - MIN(p->bytes, p->total_bytes)) *
+			elapsed / p->bytes;
+
+	if (p->total_records > 0 && p->records)
+		return (p->total_records - MIN(p->records, p->total_records)) *
+			elapsed / p->records;
+
+	return -1;
+}
+
+static void progress_push(struct pbap_job *job, const gchar *state)
+{
+	struct sync_progress *p = job->progress;
+	struct json_object *jresp = json_object_new_object();
+	gint64 now = g_get_monotonic_time();
+
+	if (!g_strcmp0(state, "transferring"))
+		progress_scan(job);
+
+	json_object_object_add(jresp, "address", json_object_new_string(job->address));
+	json_object_object_add(jresp, "list", json_object_new_string(job->list));
+	json_object_object_add(jresp, "state", json_object_new_string(state));
+	json_object_object_add(jresp, "bytes", json_object_new_int64(p->bytes));
+	json_object_object_add(jresp, "total_bytes",
+		json_object_new_int64(p->total_bytes));
+	json_object_object_add(jresp, "records", json_object_new_int(p->records));
+	json_object_object_add(jresp, "total_records",
+		json_object_new_int(p->total_records));
+	json_object_object_add(jresp, "eta", json_object_new_int64(
+		g_strcmp0(state, "transferring") ? 0 : progress_eta(p, now)));
+
+	/* stop tracking transfers once the last subscriber is gone */
+	if (pbap_event_push(sync_progress_event, jresp) <= 0)
+		g_atomic_int_set(&progress_listeners, FALSE);
+
+	p->last_push = now;
+}
+
+static gboolean progress_timeout_cb(gpointer user_data)
+{
+	struct pbap_job *job = user_data;
+
+	job->progress->timer = 0;
+	progress_push(job, "transferring");
+
+	return G_SOURCE_REMOVE;
+}
+
+/* updates in between events are coalesced into the next one */
+static void progress_update(struct pbap_job *job, guint64 bytes)
+{
+	struct sync_progress *p = job->progress;
+	gint64 wait;
+
+	p->bytes = p->base_bytes + bytes;
+	if (p->timer)
+		return;
+
+	wait = p->last_push + PROGRESS_INTERVAL * 1000 - g_get_monotonic_time();
+	if (wait <= 0)
+		progress_push(job, "transferring");
+	else
+		p->timer = pbap_loop_timeout_add(wait / 1000 + 1, progress_timeout_cb, job);
+}
+
+static void checkpoint_free(gpointer data)
+{
+	struct sync_checkpoint *cp = data;
+
+	g_string_free(cp->data, TRUE);
+	g_free(cp);
+}
+
+/* pulls of a limited number of entries keep their own checkpoint */
+static gchar *checkpoint_key(struct pbap_job *job)
+{
+	gchar *max, *key;
+
+	if (job->max_entries < 0)
+		return entry_key(job->address, job->list, NULL);
+
+	max = g_strdup_printf("%d", job->max_entries);
+	key = entry_key(job->address, job->list, max);
+	g_free(max);
+
+	return key;
+}
+
+static struct sync_checkpoint *checkpoint_lookup(struct pbap_job *job)
+{
+	gchar *key = checkpoint_key(job);
+	struct sync_checkpoint *cp = g_hash_table_lookup(checkpoints, key);
+
+	g_free(key);
+
+	return cp;
+}
+
+/* the checkpoint of the list pulled by a job, started over once expired */
+static struct sync_checkpoint *checkpoint_get(struct pbap_job *job)
+{
+	struct sync_checkpoint *cp = checkpoint_lookup(job);
+	gint64 now = g_get_monotonic_time();
+
+	if (cp && (!sync_checkpoint_age ||
+		   now - cp->updated < sync_checkpoint_age * G_USEC_PER_SEC))
+		return cp;
+
+	cp = g_new0(struct sync_checkpoint, 1);
+	cp->data = g_string_new(NULL);
+	cp->updated = now;
+	g_hash_table_replace(checkpoints, checkpoint_key(job), cp);
+
+	return cp;
+}
+
+/*
+ * Only full contacts syncs are split by choice, and measured, as the
+ * size of their entries differs from that of call history ones.
+ */
+static gboolean job_is_paged(struct pbap_job *job)
+{
+	if (job->type != JOB_PULL_ALL || job->skip_photos)
+		return FALSE;
+
+	if (job->max_entries > PBAP_MAX_COUNT)
+		return TRUE;
+
+	return job->max_entries < 0 && sync_chunk &&
+		!g_strcmp0(job->list, CONTACTS);
+}
+
+static guint chunk_window(struct pbap_job *job)
+{
+	if (!sync_chunk)
+		return PBAP_MAX_COUNT;
+
+	if (!g_strcmp0(job->list, CONTACTS))
+		return pbap_link_window(job->address);
+
+	return MIN(sync_chunk, PBAP_MAX_COUNT);
+}
+
+static void pull_vcards(struct pbap_job *job);
+
+static guint count_vcards(const gchar *vcards)
+{
+	guint count = 0;
+
+	while ((vcards = strstr(vcards, VCARD_END))) {
+		vcards += strlen(VCARD_END);
+		count++;
+	}
+
+	return count;
+}
+
+/* the vCards after the first n */
+static const gchar *skip_vcards(const gchar *vcards, guint n)
+{
+	const gchar *end;
+
+	while (n-- && (end = strstr(vcards, VCARD_END)))
+		vcards = end + strlen(VCARD_END);
+
+	while (*vcards == '\r' || *vcards == '\n')
+		vcards++;
+
+	return vcards;
+}
+
+/*
+ * Append a received window of a chunked PullAll to the checkpoint and
+ * start the next one. Returns FALSE once the last window is in.
+ */
+static gboolean chunk_next(struct pbap_job *job)
+{
+	struct sync_checkpoint *cp;
+	const gchar *vcards;
+	guint count = job->window_count;
+
+	/* the rate is unknown if the transfer was never seen active */
+	if (job->window_active && !g_strcmp0(job->list, CONTACTS))
+		pbap_link_sample(job->address,
+				 job->window_active - job->window_started,
+				 job->window_ended - job->window_active, count);
+
+	/* entries the window overlaps with the previous one */
+	vcards = json_object_get_string(job->window) + job->window_offset;
+	count -= MIN(count, job->skip);
+
+	cp = checkpoint_lookup(job);
+	if (cp) {
+		g_string_append(cp->data, vcards);
+		cp->count += count;
+		cp->updated = g_get_monotonic_time();
+	} else {
+		/* dropped as the phonebook changed meanwhile, start over */
+		cp = checkpoint_get(job);
+		count = job->chunk;
+	}
+	g_clear_pointer(&job->window, json_object_put);
+
+	if (count < job->chunk ||
+	    (job->max_entries >= 0 && cp->count >= job->max_entries))
+		return FALSE;
+
+	if (cp->count >= PBAP_MAX_PAGED) {
+		AFB_WARNING("Entries of %s on %s past %u are out of reach",
+			    job->list, job->address, PBAP_MAX_PAGED);
+		return FALSE;
+	}
+
+	g_clear_pointer(&job->filename, g_free);
+	pull_vcards(job);
+
+	return TRUE;
+}
+
+/* the whole list pulled by a chunked PullAll, ending its checkpoint */
+static struct json_object *chunk_finish(struct pbap_job *job)
+{
+	struct sync_checkpoint *cp = checkpoint_lookup(job);
+	struct json_object *vcard_str;
+	gchar *key;
+
+	vcard_str = json_object_new_string_len(cp->data->str, cp->data->len);
+
+	key = checkpoint_key(job);
+	g_hash_table_remove(checkpoints, key);
+	g_free(key);
+
+	return vcard_str;
+}
+
+/* from a worker, reads the received file and counts its vCards */
+static void transfer_read_work(gpointer data)
+{
+	struct pbap_job *job = data;
+	const gchar *vcards;
+
+	job->window = get_vcard_xfer(job->filename);
+	if (!job->window)
+		return;
+
+	vcards = json_object_get_string(job->window);
+	job->window_count = count_vcards(vcards);
+	if (job->chunk)
+		job->window_offset = skip_vcards(vcards, job->skip) - vcards;
+}
+
+/* final counts from what was read, the transfer file is gone by now */
+static void progress_complete(struct pbap_job *job)
+{
+	struct sync_progress *p = job->progress;
+	struct sync_checkpoint *cp = job->chunk ? checkpoint_lookup(job) : NULL;
+
+	if (cp) {
+		p->records = cp->count;
+		p->bytes = cp->data->len;
+	} else if (job->window) {
+		p->records = job->window_count;
+		p->bytes = json_object_get_string_len(job->window);
+	}
+
+	p->total_records = p->records;
+	p->total_bytes = p->bytes;
+}
+
+static gboolean transfer_read_done(gpointer data)
+{
+	struct pbap_job *job = data;
+	struct json_object *vcard_str, *jresp;
+
+	if (!job->window) {
+		if (job->progress)
+			progress_push(job, "error");
+		job_finish(job, NULL, job_error(job));
+		return G_SOURCE_REMOVE;
+	}
+
+	/* the session went away while the file was read */
+	if (job->dev->state != SESSION_CONNECTED) {
+		if (job->progress)
+			progress_push(job, "error");
+		g_clear_pointer(&job->window, json_object_put);
+		job_finish(job, NULL, "transfer failed");
+		return G_SOURCE_REMOVE;
+	}
+
+	if (job->chunk && chunk_next(job))
+		return G_SOURCE_REMOVE;
+
+	if (job->progress) {
+		progress_complete(job);
+		progress_push(job, "complete");
+	}
+
+	if (job->chunk) {
+		vcard_str = chunk_finish(job);
+	} else {
+		vcard_str = job->window;
+		job->window = NULL;
+	}
+
+	jresp = json_object_new_object();
+	json_object_object_add(jresp,
+		job->type == JOB_PULL ? "vcard" : "vcards", vcard_str);
+
+	if (job->type == JOB_PULL_ALL && job->max_entries < 0 && !job->skip_photos) {
+		/*
+		 * Reply now and keep the list selected to fetch the handles
+		 * matching each vCard for the entry cache and change events.
+		 */
+		job->data = g_strdup(json_object_get_string(vcard_str));
+		job_complete(job, jresp, NULL);
+		list_vcards(job);
+		return G_SOURCE_REMOVE;
+	}
+
+	job_finish(job, jresp, NULL);
+
+	return G_SOURCE_REMOVE;
+}
+
+static void transfer_done(struct pbap_job *job, gboolean success)
+{
+	if (job->progress && job->progress->timer) {
+		pbap_loop_source_remove(job->progress->timer);
+		job->progress->timer = 0;
+	}
+
+	if (!success) {
+		if (job->progress)
+			progress_push(job, "error");
+		unlink(job->filename);
+		job_finish(job, NULL, job_error(job));
+		return;
+	}
+
+	/* large lists take a while to read, other transfers go on meanwhile */
+	job->window_ended = g_get_monotonic_time();
+	pbap_loop_work(transfer_read_work, transfer_read_done, job);
+}
+
+static void on_transfer_properties_changed(const gchar *path,
+					   GVariant *changed_properties,
+					   gpointer user_data)
+{
+	GVariantIter iter;
+	const gchar *key;
+	GVariant *value;
+	struct pbap_job *job;
+	struct pbap_device *dev;
+	GHashTableIter devs;
+
+	job = NULL;
+	g_hash_table_iter_init(&devs, devices);
+	while (!job && g_hash_table_iter_next(&devs, NULL, (gpointer *) &dev))
+		job = g_hash_table_lookup(dev->xfers, path);
+
+	if (job) {
+		g_variant_iter_init(&iter, changed_properties);
+		while (g_variant_iter_next(&iter, "{&sv}", &key, &value)) {
+			gboolean done = FALSE, success = FALSE;
+
+			if (!g_strcmp0(key, "Status")) {
+				const gchar *val = g_variant_get_string(value, NULL);
+
+				success = !g_strcmp0(val, "complete");
+				done = success || !g_strcmp0(val, "error");
+				if (!g_strcmp0(val, "active") && !job->window_active)
+					job->window_active = g_get_monotonic_time();
+			} else if (!g_strcmp0(key, "Transferred") && job->progress) {
+				progress_update(job, g_variant_get_uint64(value));
+			}
+			g_variant_unref(value);
+
+			if (done) {
+				g_hash_table_remove(job->dev->xfers, path);
+				g_atomic_int_add(&live.transfers, -1);
+				transfer_done(job, success);
+				break;
+			}
+		}
+	}
+}
+
+static void get_filename(gchar *filename, const gchar *address)
+{
+	struct tm* tm_info;;
+	struct timeval tv;
+	long ms;
+	gchar buffer[64];
+	gchar *device;
+
+	gettimeofday(&tv, NULL);
+
+	ms = lrint((double)tv.tv_usec/1000.0);
+	if (ms >= 1000) {
+		ms -=1000;
+		tv.tv_sec++;
+	}
+	tm_info = localtime(&tv.tv_sec);
+
+	strftime(buffer, 26, "%Y%m%d%H%M%S", tm_info);
+
+	/* transfers of several devices may start within the same millisecond */
+	device = g_strdelimit(g_strdup(address), ":", '_');
+	sprintf(filename, "/tmp/vcard-%s-%s%03ld.dat", device, buffer, ms);
+	g_free(device);
+}
+
+static void transfer_started_cb(GObject *source, GAsyncResult *res,
+				gpointer user_data)
+{
+	struct pbap_job *job = user_data;
+	GVariant *properties = NULL;
+	GError *error = NULL;
+	gchar *tpath = NULL;
+
+	if (!pbap_obex_pull_finish(res, &tpath, &properties, &error)) {
+		AFB_ERROR("Failed to start transfer: %s", error->message);
+		g_error_free(error);
+		job_finish(job, NULL, job_error(job));
+		return;
+	}
+
+	/* the device went away or the deadline passed meanwhile */
+	if (job->dev->state != SESSION_CONNECTED || job->timed_out) {
+		if (job->timed_out)
+			pbap_obex_cancel_transfer(tpath);
+		g_variant_unref(properties);
+		g_free(tpath);
+		job_finish(job, NULL, job_error(job));
+		return;
+	}
+
+	/* the size of a window says nothing about the whole list */
+	if (job->progress && !job->chunk)
+		g_variant_lookup(properties, "Size", "t", &job->progress->total_bytes);
+
+	g_variant_unref(properties);
+	g_hash_table_insert(job->dev->xfers, tpath, job);
+	g_atomic_int_inc(&live.transfers);
+}
+
+static void pull_vcard(struct pbap_job *job)
+{
+	GVariantBuilder *b;
+	GVariant *filter;
+	gchar filename[256];
+
+	b = g_variant_builder_new (G_VARIANT_TYPE ("a{sv}"));
+	g_variant_builder_add(b, "{sv}", "Format", g_variant_new_string("vcard30"));
+	filter = g_variant_builder_end(b);
+
+	get_filename(filename, job->address);
+	job->filename = g_strdup(filename);
+	pbap_obex_pull(job->dev->session, job->handle, filename, filter,
+		       job->dev->cancel, transfer_started_cb, job);
+
+	g_variant_builder_unref(b);
+}
+
+/* vCard fields of the contacts stage, everything but binary ones */
+static const gchar *text_fields[] = {
+	"VERSION", "FN", "N", "BDAY", "ADR", "LABEL", "TEL", "EMAIL",
+	"MAILER", "TZ", "GEO", "TITLE", "ROLE", "AGENT", "ORG", "NOTE",
+	"REV", "URL", "UID", "NICKNAME", "CATEGORIES", "PROID", "CLASS",
+	"SORT-STRING", "X-IRMC-CALL-DATETIME", "X-BT-SPEEDDIALKEY",
+	"X-BT-UCI", "X-BT-UID", NULL
+};
+
+static void pull_vcards(struct pbap_job *job)
+{
+	struct sync_checkpoint *cp;
+	GVariantBuilder *b;
+	GVariant *filter;
+	gchar filename[256];
+	guint offset = 0;
+
+	if (job->chunk) {
+		cp = checkpoint_get(job);
+		offset = MIN(cp->count, PBAP_MAX_COUNT);
+		job->skip = cp->count - offset;
+		/* windows re-pulling the overlap would grow quadratically */
+		job->chunk = job->skip ? PBAP_MAX_COUNT - job->skip :
+					 chunk_window(job);
+		if (job->max_entries >= 0)
+			job->chunk = MIN(job->chunk, job->max_entries - cp->count);
+		job->window_started = g_get_monotonic_time();
+		job->window_active = 0;
+		if (job->progress) {
+			job->progress->records = cp->count;
+			job->progress->base_bytes = cp->data->len;
+			job->progress->scanned = 0;
+		}
+	}
+
+	b = g_variant_builder_new (G_VARIANT_TYPE ("a{sv}"));
+	g_variant_builder_add(b, "{sv}", "Format", g_variant_new_string("vcard30"));
+	g_variant_builder_add(b, "{sv}", "Order", g_variant_new_string("indexed"));
+	g_variant_builder_add(b, "{sv}", "Offset", g_variant_new_uint16((guint16)offset));
+	if (job->chunk)
+		g_variant_builder_add(b, "{sv}", "MaxCount",
+				      g_variant_new_uint16((guint16)(job->chunk + job->skip)));
+	else if (job->max_entries >= 0)
+		g_variant_builder_add(b, "{sv}", "MaxCount", g_variant_new_uint16((guint16)job->max_entries));
+	if (job->skip_photos)
+		g_variant_builder_add(b, "{sv}", "Fields",
+				      g_variant_new_strv(text_fields, -1));
+	filter = g_variant_builder_end(b);
+
+	get_filename(filename, job->address);
+	job->filename = g_strdup(filename);
+	pbap_obex_pull_all(job->dev->session, filename, filter,
+			   job->dev->cancel, transfer_started_cb, job);
+	g_variant_builder_unref(b);
+}
+
+static void search_cb(GObject *source, GAsyncResult *res, gpointer user_data)
+{
+	struct json_object *results_array, *response;
+	struct pbap_job *job = user_data;
+	GError *error = NULL;
+	GVariantIter iter;
+	GVariant *entry, *results;
+	gchar *card, *name;
+
+	if (!pbap_obex_list_finish(res, &results, &error)) {
+		AFB_ERROR("Search failed: %s", error->message);
+		g_error_free(error);
+		job_finish(job, NULL, "search failed");
+		return;
+	}
+
+	results_array = json_object_new_array();
+	g_variant_iter_init(&iter, results);
+	while ((entry = g_variant_iter_next_value(&iter))) {
+		g_variant_get(entry, "(ss)", &card, &name);
+		g_variant_unref(entry);
+		json_object *result_obj = json_object_new_object();
+		json_object *card_str = json_object_new_string(card);
+		json_object *name_str = json_object_new_string(name);
+		json_object_object_add(result_obj, "handle", card_str);
+		json_object_object_add(result_obj, "name", name_str);
+		json_object_array_add(results_array, result_obj);
+		g_free(card);
+		g_free(name);
+	}
+	g_variant_unref(results);
+
+	response = json_object_new_object();
+	json_object_object_add(response, "results", results_array);
+
+	job_finish(job, response, NULL);
+}
+
+static void search_vcards(struct pbap_job *job)
+{
+	GVariantBuilder *b;
+	GVariant *filter;
+
+	b = g_variant_builder_new (G_VARIANT_TYPE ("a{sv}"));
+	g_variant_builder_add(b, "{sv}", "Order", g_variant_new_string("indexed"));
+	g_variant_builder_add(b, "{sv}", "Offset", g_variant_new_uint16(0));
+	g_variant_builder_add(b, "{sv}", "Format", g_variant_new_string("vcard30"));
+	if (job->max_entries >= 0)
+		g_variant_builder_add(b, "{sv}", "MaxCount", g_variant_new_uint16((guint16)job->max_entries));
+	filter = g_variant_builder_end(b);
+
+	pbap_obex_search(job->dev->session, "number", job->number, filter,
+			 job->dev->cancel, search_cb, job);
+
+	g_variant_builder_unref(b);
+}
+
+static void get_size_cb(GObject *source, GAsyncResult *res, gpointer user_data)
+{
+	struct pbap_job *job = user_data;
+	GError *error = NULL;
+	guint16 size;
+
+	if (!pbap_obex_get_size_finish(res, &size, &error)) {
+		AFB_WARNING("Failed to get size of %s: %s", job->list, error->message);
+		g_error_free(error);
+	} else {
+		job->progress->total_records = job->max_entries >= 0 ?
+			MIN(size, job->max_entries) : size;
+	}
+
+	pull_vcards(job);
+}
+
+static void select_cb(GObject *source, GAsyncResult *res, gpointer user_data)
+{
+	struct pbap_job *job = user_data;
+	GError *error = NULL;
+
+	if (!pbap_obex_select_finish(res, &error)) {
+		AFB_ERROR("Failed to select %s: %s", job->list, error->message);
+		g_error_free(error);
+		job_finish(job, NULL, "select failed");
+		return;
+	}
+
+	if (job->timed_out) {
+		job_finish(job, NULL, "timeout");
+		return;
+	}
+
+	switch (job->type) {
+	case JOB_PULL_ALL:
+		if (job_is_paged(job)) {
+			struct sync_checkpoint *cp = checkpoint_get(job);
+
+			job->chunk = chunk_window(job);
+			if (cp->count)
+				AFB_NOTICE("Resuming %s of %s at entry %u",
+					   job->list, job->address, cp->count);
+		}
+
+		if (!g_atomic_int_get(&progress_listeners)) {
+			pull_vcards(job);
+			break;
+		}
+
+		job->progress = g_new0(struct sync_progress, 1);
+		job->progress->started = g_get_monotonic_time();
+		job->progress->total_records = -1;
+		pbap_obex_get_size(job->dev->session, job->dev->cancel,
+				   get_size_cb, job);
+		break;
+	case JOB_PULL:
+		pull_vcard(job);
+		break;
+	case JOB_SEARCH:
+		search_vcards(job);
+		break;
+	case JOB_LIST:
+		list_entries(job);
+		break;
+	}
+}
+
+static void scheduler_run_next(struct pbap_device *dev)
+{
+	struct pbap_job *job;
+
+	/* jobs wait for the session being set up */
+	if (dev->attempt)
+		return;
+
+	while (!dev->current_job && (job = g_queue_pop_head(&dev->jobs))) {
+		if (dev->state != SESSION_CONNECTED) {
+			job_complete(job, NULL, device_error(dev, "not connected"));
+			free_job(job);
+			continue;
+		}
+
+		dev->current_job = job;
+		pbap_obex_select(dev->session, INTERNAL, job->list,
+				 dev->cancel, select_cb, job);
+	}
+}
+
+static void queue_count_timeout(gboolean cancelled)
+{
+	g_mutex_lock(&queue_stats.mutex);
+	queue_stats.timeouts++;
+	if (cancelled)
+		queue_stats.cancelled++;
+	g_mutex_unlock(&queue_stats.mutex);
+}
+
+static gboolean job_watchdog_cb(gpointer user_data)
+{
+	struct pbap_job *job = user_data;
+	struct pbap_device *dev = job->dev;
+	GHashTableIter iter;
+	gpointer tpath = NULL, value;
+
+	job->watchdog = 0;
+	AFB_WARNING("%s request for %s timed out", job->list, job->address);
+
+	if (job->leader) {
+		job->leader->joined = g_slist_remove(job->leader->joined, job);
+		queue_count_timeout(FALSE);
+		job_complete(job, NULL, "timeout");
+		free_job(job);
+		return G_SOURCE_REMOVE;
+	}
+
+	if (g_queue_remove(&dev->jobs, job)) {
+		queue_count_timeout(FALSE);
+		job_complete(job, NULL, "timeout");
+		free_job(job);
+		return G_SOURCE_REMOVE;
+	}
+
+	job->timed_out = TRUE;
+
+	g_hash_table_iter_init(&iter, dev->xfers);
+	while (!tpath && g_hash_table_iter_next(&iter, &tpath, &value)) {
+		if (value != job)
+			tpath = NULL;
+	}
+
+	queue_count_timeout(tpath != NULL);
+
+	if (tpath) {
+		pbap_obex_cancel_transfer(tpath);
+		g_hash_table_remove(dev->xfers, tpath);
+		g_atomic_int_add(&live.transfers, -1);
+		transfer_done(job, FALSE);
+		return G_SOURCE_REMOVE;
+	}
+
+	/* the pending call fails or returns on its own, the request cannot wait */
+	job_complete(job, NULL, "timeout");
+
+	return G_SOURCE_REMOVE;
+}
+
+static void job_watchdog_start(struct pbap_job *job)
+{
+	gint64 wait;
+
+	if (!job->deadline)
+		return;
+
+	wait = job->deadline - g_get_monotonic_time();
+	job->watchdog = pbap_loop_timeout_add(MAX(wait / 1000, 0), job_watchdog_cb, job);
+}
+
+static gboolean job_matches(struct pbap_job *job, struct pbap_job *other)
+{
+	return job->type == other->type &&
+	       !g_strcmp0(job->list, other->list) &&
+	       job->max_entries == other->max_entries &&
+	       job->skip_photos == other->skip_photos &&
+	       !g_strcmp0(job->handle, other->handle) &&
+	       !g_strcmp0(job->number, other->number);
+}
+
+/* an identical job of the device whose result is still to come */
+static struct pbap_job *job_find_pending(struct pbap_device *dev,
+					 struct pbap_job *job)
+{
+	struct pbap_job *other = dev->current_job;
+	GList *l;
+
+	if (other && other->complete && job_matches(job, other))
+		return other;
+
+	for (l = dev->jobs.head; l; l = l->next) {
+		if (job_matches(job, l->data))
+			return l->data;
+	}
+
+	return NULL;
+}
+
+static gboolean job_post_cb(gpointer user_data)
+{
+	struct pbap_job *job = user_data;
+	struct pbap_device *dev = g_hash_table_lookup(devices, job->address);
+	struct pbap_job *pending;
+
+	if (!dev) {
+		job->complete(job, NULL, "not connected");
+		free_job(job);
+		return G_SOURCE_REMOVE;
+	}
+
+	/* a request shares the result of an identical one in flight */
+	pending = job->request ? job_find_pending(dev, job) : NULL;
+	if (pending) {
+		pending->joined = g_slist_append(pending->joined, job);
+		job->leader = pending;
+		job_watchdog_start(job);
+		g_mutex_lock(&queue_stats.mutex);
+		queue_stats.coalesced++;
+		g_mutex_unlock(&queue_stats.mutex);
+		return G_SOURCE_REMOVE;
+	}
+
+	job->dev = device_ref(dev);
+	g_queue_push_tail(&dev->jobs, job);
+	job_watchdog_start(job);
+	scheduler_run_next(dev);
+
+	return G_SOURCE_REMOVE;
+}
+
+static gint64 job_timeout_default(struct pbap_job *job)
+{
+	switch (job->type) {
+	case JOB_PULL_ALL:
+		return g_strcmp0(job->list, CONTACTS) ?
+			timeouts.history : timeouts.contacts;
+	case JOB_PULL:
+		return timeouts.entry;
+	case JOB_SEARCH:
+		return timeouts.search;
+	case JOB_LIST:
+		return timeouts.listing;
+	}
+
+	return 0;
+}
+
+/* seconds of the "timeout" of a request, 0 if it has none, -1 if invalid */
+static gint64 request_timeout(afb_req_t request)
+{
+	struct json_object *val;
+
+	if (!json_object_object_get_ex(afb_req_json(request), "timeout", &val))
+		return 0;
+
+	if (!json_object_is_type(val, json_type_int) ||
+	    json_object_get_int64(val) <= 0)
+		return -1;
+
+	return json_object_get_int64(val);
+}
+
+/* returns NULL once the deadline is set, or the error of the request */
+static const char *job_set_deadline(struct pbap_job *job)
+{
+	gint64 timeout, requested;
+
+	/* a sync in the background would otherwise fail on every slow link */
+	if (!job->request)
+		return NULL;
+
+	timeout = job_timeout_default(job);
+	requested = request_timeout(job->request);
+	if (requested < 0)
+		return "invalid timeout";
+	if (requested)
+		timeout = requested;
+
+	if (timeout)
+		job->deadline = g_get_monotonic_time() + timeout * G_USEC_PER_SEC;
+
+	return NULL;
+}
+
+/*
+ * May be called from any thread, the job is run from the main loop.
+ * Jobs of a request over its limits fail right away.
+ */
+static void scheduler_queue_job(struct pbap_job *job)
+{
+	const char *error;
+
+	if ((error = job_set_deadline(job)) ||
+	    (job->request && (error = queue_admit(job)))) {
+		AFB_WARNING("Rejected %s request for %s: %s",
+			    job->list, job->address, error);
+		job->complete(job, NULL, error);
+		free_job(job);
+		return;
+	}
+
+	pbap_loop_post(job_post_cb, job);
+}
+
+/* a contacts list for the cache, then the request that fetched it, if any */
+struct cache_task {
+	gchar *address;
+	gboolean refresh;
+	struct json_object *result;
+	const char *error;
+	afb_req_t request;
+	const char *info;
+};
+
+static void cache_update_work(gpointer data)
+{
+	struct cache_task *task = data;
+
+	pbap_cache_update(task->address, task->refresh,
+			  task->error ? NULL : task->result);
+
+	if (task->request && !task->error) {
+		afb_req_success(task->request, task->result, task->info);
+	} else {
+		if (task->request)
+			afb_req_fail(task->request, task->error, NULL);
+		json_object_put(task->result);
+	}
+
+	if (task->request)
+		afb_req_unref(task->request);
+	g_free(task->address);
+	g_free(task);
+}
+
+/*
+ * Hashing, serializing and compressing a large list for persistence
+ * is left to a worker. Takes over result and the reference to request.
+ */
+static void cache_update_async(const gchar *address, gboolean refresh,
+			       struct json_object *result, const char *error,
+			       afb_req_t request, const char *info)
+{
+	struct cache_task *task = g_new0(struct cache_task, 1);
+
+	task->address = g_strdup(address);
+	task->refresh = refresh;
+	task->result = result;
+	task->error = error;
+	task->request = request;
+	task->info = info;
+
+	pbap_loop_work(cache_update_work, NULL, task);
+}
+
+static void contacts_refresh_done(struct pbap_job *job,
+				  struct json_object *result,
+				  const char *error)
+{
+	cache_update_async(job->address, !job->request, result, error,
+			   job->request, job->info);
+	job->request = NULL;
+}
+
+/*
+ * Fetch all contacts and update the cache. Without a request this is a
+ * background refresh and only one per device is queued at a time.
+ */
+static void contacts_refresh(const gchar *address, afb_req_t request)
+{
+	struct pbap_job *job;
+
+	if (!request && !pbap_cache_begin_refresh(address))
+		return;
+
+	job = job_new(address, JOB_PULL_ALL, CONTACTS, -1, request, "contacts");
+	job->complete = contacts_refresh_done;
+	scheduler_queue_job(job);
+}
+
+static void kept_done(struct pbap_job *job, struct json_object *result,
+		      const char *error);
+
+/* fetch a complete call history list in the background for its changes */
+static void history_refresh(const gchar *address, const gchar *list)
+{
+	struct pbap_job *job;
+
+	job = job_new(address, JOB_PULL_ALL, list, -1, NULL, "call history");
+	if (!g_strcmp0(list, COMBINED))
+		job->complete = kept_done;
+	scheduler_queue_job(job);
+}
+
+/* the listing or the complete combined call history of a device */
+static struct json_object **device_kept(struct pbap_device *dev,
+					struct pbap_job *job)
+{
+	return job->type == JOB_LIST ? &dev->listing : &dev->history;
+}
+
+/* kept for the listing and history verbs, only while the device is known */
+static void kept_store(struct pbap_job *job, struct json_object *result)
+{
+	struct json_object *copy = NULL, **kept;
+	struct pbap_device *dev;
+
+	dev = g_hash_table_lookup(devices, job->address);
+	if (!dev)
+		return;
+
+	kept = device_kept(dev, job);
+	json_object_put(*kept);
+	json_object_deep_copy(result, &copy, NULL);
+	*kept = copy;
+}
+
+static void pipeline_record(struct sync_pipeline *pl, const gchar *address)
+{
+	gint64 elapsed = g_get_monotonic_time() - pl->started;
+
+	g_mutex_lock(&pipeline_stats.mutex);
+	pipeline_stats.stages[pl->stage] = elapsed;
+	/* usable once both the listing and the recent calls can be shown */
+	if (pl->stage == STAGE_HISTORY) {
+		pipeline_stats.runs++;
+		pipeline_stats.usable = elapsed;
+		pipeline_stats.usable_total += elapsed;
+	}
+	g_mutex_unlock(&pipeline_stats.mutex);
+
+	AFB_INFO("%s of %s synced after %" G_GINT64_FORMAT " ms",
+		 stage_names[pl->stage], address, elapsed / 1000);
+}
+
+static void pipeline_queue(const gchar *address, struct sync_pipeline *pl);
+
+static void pipeline_done(struct pbap_job *job, struct json_object *result,
+			  const char *error)
+{
+	struct sync_pipeline *pl = job->pipeline;
+	struct json_object *vcards = NULL;
+
+	job->pipeline = NULL;
+
+	switch (pl->stage) {
+	case STAGE_LISTING:
+	case STAGE_HISTORY:
+		if (!error)
+			kept_store(job, result);
+		break;
+	case STAGE_CONTACTS:
+		if (!error && json_object_object_get_ex(result, "vcards", &vcards))
+			numbers_index_async(job->address,
+					    json_object_get_string(vcards));
+		if (!error)
+			cache_update_async(job->address, FALSE,
+					   json_object_get(result), NULL, NULL, NULL);
+		break;
+	case STAGE_PHOTOS:
+		cache_update_async(job->address, TRUE, json_object_get(result),
+				   error, NULL, NULL);
+		break;
+	default:
+		break;
+	}
+	json_object_put(result);
+
+	/* the session it was started for is gone, a new one has its own */
+	if (!job->dev || job->dev->state != SESSION_CONNECTED ||
+	    g_hash_table_lookup(devices, job->address) != job->dev) {
+		AFB_DEBUG("Sync of %s aborted at %s", job->address,
+			  stage_names[pl->stage]);
+		g_free(pl);
+		return;
+	}
+
+	if (!error)
+		pipeline_record(pl, job->address);
+
+	pl->stage++;
+	pipeline_queue(job->address, pl);
+}
+
+static void pipeline_queue(const gchar *address, struct sync_pipeline *pl)
+{
+	struct pbap_job *job = NULL;
+
+	switch (pl->stage) {
+	case STAGE_LISTING:
+		job = job_new(address, JOB_LIST, CONTACTS, -1, NULL, "listing");
+		break;
+	case STAGE_HISTORY:
+		job = job_new(address, JOB_PULL_ALL, COMBINED, -1, NULL, "call history");
+		break;
+	case STAGE_CONTACTS:
+		/* cached contacts already have their photos */
+		if (pbap_cache_has(address)) {
+			pl->stage++;
+			pipeline_queue(address, pl);
+			return;
+		}
+		job = job_new(address, JOB_PULL_ALL, CONTACTS, -1, NULL, "contacts");
+		job->skip_photos = TRUE;
+		break;
+	case STAGE_PHOTOS:
+		if (pbap_cache_begin_refresh(address))
+			job = job_new(address, JOB_PULL_ALL, CONTACTS, -1, NULL, "contacts");
+		break;
+	case STAGE_DONE:
+		break;
+	}
+
+	if (!job) {
+		history_refresh(address, INCOMING);
+		history_refresh(address, OUTGOING);
+		history_refresh(address, MISSED);
+		g_free(pl);
+		return;
+	}
+
+	/* each stage is queued once the previous one is done, so requests come first */
+	job->pipeline = pl;
+	job->complete = pipeline_done;
+	scheduler_queue_job(job);
+}
+
+static void pipeline_start(const gchar *address)
+{
+	struct sync_pipeline *pl = g_new0(struct sync_pipeline, 1);
+
+	pl->stage = STAGE_LISTING;
+	pl->started = g_get_monotonic_time();
+	pipeline_queue(address, pl);
+}
+
+/* "dev_F8_34_41_DE_C3_6F" names of Bluetooth-Manager are also accepted */
+static gchar *device_to_address(const gchar *device)
+{
+	gchar *address;
+
+	if (g_str_has_prefix(device, "dev_"))
+		device += strlen("dev_");
+
+	address = g_ascii_strup(device, -1);
+	g_strdelimit(address, "_", ':');
+
+	return address;
+}
+
+/* "XX:XX:XX:XX:XX:XX" with hexadecimal digits */
+static gboolean address_is_valid(const gchar *address)
+{
+	int i;
+
+	for (i = 0; i < 17; i++) {
+		if (i % 3 == 2 ? address[i] != ':' : !g_ascii_isxdigit(address[i]))
+			return FALSE;
+	}
+
+	return address[i] == '\0';
+}
+
+/*
+ * Address of the "device" filter of an event subscription, NULL for
+ * any device. Returns FALSE if the device cannot be parsed.
+ */
+static gboolean filter_address(afb_req_t request, gchar **address)
+{
+	const char *device = afb_req_value(request, "device");
+
+	*address = device ? device_to_address(device) : NULL;
+	if (*address && !address_is_valid(*address)) {
+		g_clear_pointer(address, g_free);
+		return FALSE;
+	}
+
+	return TRUE;
+}
+
+/*
+ * Address of the device named by the "device" parameter, or of the
+ * default device. Fails the request and returns NULL unless a session
+ * with it is up or being set up. A named device without any session
+ * is unknown. The timeout is checked first, so that it fails the same
+ * whether or not a device is connected.
+ */
+static gchar *request_address(afb_req_t request)
+{
+	const char *device = afb_req_value(request, "device");
+	enum session_state state = SESSION_DISCONNECTED;
+	const struct status_snapshot *snap;
+	const struct device_status *ds;
+	gchar *address;
+
+	if (request_timeout(request) < 0) {
+		afb_req_fail(request, "invalid timeout", NULL);
+		return NULL;
+	}
+
+	snap = snapshot_acquire();
+	address = device ? device_to_address(device) : g_strdup(snap->default_address);
+	ds = snapshot_find(snap, address);
+	if (ds)
+		state = ds->state;
+	snapshot_release();
+
+	if (device && !ds) {
+		afb_req_fail(request, "unknown device", NULL);
+		g_free(address);
+		return NULL;
+	}
+
+	if (state != SESSION_CONNECTED && state != SESSION_CONNECTING) {
+		afb_req_fail(request, "not connected", NULL);
+		g_free(address);
+		return NULL;
+	}
+
+	return address;
+}
+
+static gboolean parse_list_parameter(afb_req_t request, gchar **list)
+{
+	struct json_object *list_obj, *query;
+	const gchar *list_str;
+
+	query = afb_req_json(request);
+
+	if (json_object_object_get_ex(query, "list", &list_obj) == TRUE) {
+		if (json_object_is_type(list_obj, json_type_string)) {
+			list_str = json_object_get_string(list_obj);
+			if (!g_strcmp0(list_str, COMBINED)) {
+				*list = COMBINED;
+			} else if (!g_strcmp0(list_str, INCOMING)) {
+				*list = INCOMING;
+			} else if (!g_strcmp0(list_str, OUTGOING)) {
+				*list = OUTGOING;
 			} else if (!g_strcmp0(list_str, MISSED)) {
 				*list = MISSED;
 			} else if (!g_strcmp0(list_str, CONTACTS)) {
@@ -328,355 +2300,1025 @@ static gboolean parse_list_parameter(afb_req_t request, gchar **list)
 		return FALSE;
 	}
 
-	return TRUE;
+	return TRUE;
+}
+
+/* limit is the most entries a verb can reach */
+static gboolean parse_max_entries_parameter(afb_req_t request, int *max_entries,
+					    int limit)
+{
+	struct json_object *max_obj, *query;
+
+	query = afb_req_json(request);
+
+	if (json_object_object_get_ex(query, "max_entries", &max_obj) == TRUE) {
+		if (json_object_is_type(max_obj, json_type_int)) {
+			*max_entries = json_object_get_int(max_obj);
+			if ((*max_entries < 0) || (*max_entries > limit)) {
+				afb_req_fail(request, "max_entries out of range", NULL);
+				return FALSE;
+			}
+		} else {
+			afb_req_fail(request, "max_entries not integer", NULL);
+			return FALSE;
+		}
+	}
+
+	return TRUE;
+}
+
+void contacts(afb_req_t request)
+{
+	struct json_object *cached;
+	gboolean stale = FALSE;
+	int max_entries = -1;
+	gchar *address;
+
+	if (!parse_max_entries_parameter(request, &max_entries,
+					 PBAP_MAX_PAGED))
+		return;
+
+	address = request_address(request);
+	if (!address)
+		return;
+
+	if (max_entries != -1) {
+		scheduler_queue_job(job_new(address, JOB_PULL_ALL, CONTACTS,
+				max_entries, request, "contacts"));
+		g_free(address);
+		return;
+	}
+
+	cached = pbap_cache_lookup(address, &stale);
+	if (!cached) {
+		contacts_refresh(address, request);
+		g_free(address);
+		return;
+	}
+
+	afb_req_success(request, cached, "contacts");
+
+	if (stale)
+		contacts_refresh(address, NULL);
+	g_free(address);
+}
+
+static void kept_done(struct pbap_job *job, struct json_object *result,
+		      const char *error)
+{
+	if (!error)
+		kept_store(job, result);
+	job_reply(job, result, error);
+}
+
+/* answered from what is kept for the device, or queued otherwise */
+static gboolean kept_post_cb(gpointer user_data)
+{
+	struct pbap_job *job = user_data;
+	struct pbap_device *dev = g_hash_table_lookup(devices, job->address);
+	struct json_object *cached = NULL;
+
+	if (!dev || !*device_kept(dev, job)) {
+		scheduler_queue_job(job);
+		return G_SOURCE_REMOVE;
+	}
+
+	json_object_deep_copy(*device_kept(dev, job), &cached, NULL);
+	job_reply(job, cached, NULL);
+	free_job(job);
+
+	return G_SOURCE_REMOVE;
+}
+
+static void listing(afb_req_t request)
+{
+	struct pbap_job *job;
+	gchar *address;
+
+	address = request_address(request);
+	if (!address)
+		return;
+
+	job = job_new(address, JOB_LIST, CONTACTS, -1, request, "listing");
+	job->complete = kept_done;
+	pbap_loop_post(kept_post_cb, job);
+	g_free(address);
+}
+
+static void entry_done(struct pbap_job *job, struct json_object *result,
+		       const char *error)
+{
+	struct json_object *val = NULL;
+	gchar *key;
+
+	if (json_object_object_get_ex(result, "vcard", &val)) {
+		key = entry_key(job->address, job->list, job->handle);
+		pbap_lru_insert(entry_cache, key, json_object_get_string(val));
+		g_free(key);
+	}
+
+	job_reply(job, result, error);
+}
+
+void entry(afb_req_t request)
+{
+	struct json_object *handle_obj, *query, *jresp;
+	struct pbap_job *job;
+	const gchar *handle;
+	gchar *list = NULL, *key, *vcard, *address;
+
+	query = afb_req_json(request);
+
+	if (json_object_object_get_ex(query, "handle", &handle_obj) == TRUE) {
+		if (json_object_is_type(handle_obj, json_type_string)) {
+			handle = json_object_get_string(handle_obj);
+		} else {
+			afb_req_fail(request, "handle not string", NULL);
+			return;
+		}
+	} else {
+		afb_req_fail(request, "no handle", NULL);
+		return;
+	}
+
+	if (!parse_list_parameter(request, &list))
+		return;
+
+	address = request_address(request);
+	if (!address)
+		return;
+
+	job = job_new(address, JOB_PULL, list, -1, request, "list entry");
+	job->handle = g_strdup(handle);
+	g_free(address);
+
+	key = entry_key(job->address, list, handle);
+	vcard = pbap_lru_lookup(entry_cache, key);
+	g_free(key);
+
+	if (vcard) {
+		jresp = json_object_new_object();
+		json_object_object_add(jresp, "vcard", json_object_new_string(vcard));
+		g_free(vcard);
+		job_reply(job, jresp, NULL);
+		free_job(job);
+		return;
+	}
+
+	job->complete = entry_done;
+	scheduler_queue_job(job);
+}
+
+void history(afb_req_t request)
+{
+	gchar *list = NULL, *address;
+	struct pbap_job *job;
+	int max_entries = -1;
+
+	if (!parse_list_parameter(request, &list))
+		return;
+
+	if (!parse_max_entries_parameter(request, &max_entries,
+					 PBAP_MAX_PAGED))
+		return;
+
+	address = request_address(request);
+	if (!address)
+		return;
+
+	job = job_new(address, JOB_PULL_ALL, list, max_entries, request,
+		      "call history");
+	g_free(address);
+
+	if (!g_strcmp0(list, COMBINED) && max_entries < 0) {
+		job->complete = kept_done;
+		pbap_loop_post(kept_post_cb, job);
+		return;
+	}
+
+	scheduler_queue_job(job);
+}
+
+static void search(afb_req_t request)
+{
+	struct json_object *query, *val;
+	const char *number = NULL;
+	struct pbap_job *job;
+	int max_entries = -1;
+	gchar *address;
+
+	query = afb_req_json(request);
+
+	json_object_object_get_ex(query, "number", &val);
+	if (json_object_is_type(val, json_type_string)) {
+		number = json_object_get_string(val);
+	}
+	else {
+		afb_req_fail(request, "no number", NULL);
+		return;
+	}
+
+	if (!parse_max_entries_parameter(request, &max_entries,
+					 PBAP_MAX_COUNT))
+		return;
+
+	address = request_address(request);
+	if (!address)
+		return;
+
+	job = job_new(address, JOB_SEARCH, CONTACTS, max_entries, request, NULL);
+	job->number = g_strdup(number);
+	scheduler_queue_job(job);
+	g_free(address);
+}
+
+/* status of a device, or of the default device without an address */
+static struct json_object *status_json(const struct status_snapshot *snap,
+				       const gchar *address)
+{
+	struct json_object *jresp = json_object_new_object();
+	enum session_state state = SESSION_DISCONNECTED;
+	const struct device_status *ds;
+
+	if (!address)
+		address = snap->default_address;
+	ds = snapshot_find(snap, address);
+	if (ds)
+		state = ds->state;
+
+	json_object_object_add(jresp, "connected",
+		json_object_new_boolean(state == SESSION_CONNECTED));
+	json_object_object_add(jresp, "state",
+		json_object_new_string(session_states[state]));
+	if (address)
+		json_object_object_add(jresp, "address",
+			json_object_new_string(address));
+
+	return jresp;
+}
+
+static void status(afb_req_t request)
+{
+	const char *device = afb_req_value(request, "device");
+	const struct status_snapshot *snap;
+	struct json_object *response, *list;
+	gchar *address;
+	int i;
+
+	snap = snapshot_acquire();
+	if (device) {
+		address = device_to_address(device);
+		response = status_json(snap, address);
+		g_free(address);
+	} else {
+		response = status_json(snap, NULL);
+		list = json_object_new_array();
+		for (i = 0; i < snap->devices->len; i++)
+			json_object_array_add(list, status_json(snap,
+				g_array_index(snap->devices, struct device_status, i).address));
+		json_object_object_add(response, "devices", list);
+	}
+	snapshot_release();
+
+	afb_req_success(request, response, NULL);
+}
+
+static void metrics(afb_req_t request)
+{
+	struct json_object *response = json_object_new_object();
+
+	struct json_object *sessions = json_object_new_object();
+	struct json_object *pipeline = json_object_new_object(), *stages;
+	struct json_object *queue = json_object_new_object(), *depths;
+	GHashTableIter iter;
+	gpointer key, value;
+	int i;
+
+	pbap_cache_metrics(response);
+	pbap_link_metrics(response);
+	json_object_object_add(response, "entries", pbap_lru_stats(entry_cache));
+
+	json_object_object_add(sessions, "devices",
+		json_object_new_int(g_atomic_int_get(&live.devices)));
+	json_object_object_add(sessions, "jobs",
+		json_object_new_int(g_atomic_int_get(&live.jobs)));
+	json_object_object_add(sessions, "transfers",
+		json_object_new_int(g_atomic_int_get(&live.transfers)));
+	json_object_object_add(sessions, "created",
+		json_object_new_int(g_atomic_int_get(&live.sessions_created)));
+	json_object_object_add(sessions, "removed",
+		json_object_new_int(g_atomic_int_get(&live.sessions_removed)));
+	json_object_object_add(response, "sessions", sessions);
+
+	depths = json_object_new_object();
+	g_mutex_lock(&queue_stats.mutex);
+	json_object_object_add(queue, "limit", json_object_new_int64(queue_depth));
+	json_object_object_add(queue, "client_limit", json_object_new_int64(queue_client));
+	json_object_object_add(queue, "admitted",
+		json_object_new_int(queue_stats.admitted));
+	json_object_object_add(queue, "rejected",
+		json_object_new_int(queue_stats.rejected));
+	json_object_object_add(queue, "rejected_client",
+		json_object_new_int(queue_stats.rejected_client));
+	json_object_object_add(queue, "coalesced",
+		json_object_new_int(queue_stats.coalesced));
+	json_object_object_add(queue, "timeouts",
+		json_object_new_int(queue_stats.timeouts));
+	json_object_object_add(queue, "transfers_cancelled",
+		json_object_new_int(queue_stats.cancelled));
+	g_hash_table_iter_init(&iter, queue_stats.depths);
+	while (g_hash_table_iter_next(&iter, &key, &value))
+		json_object_object_add(depths, key,
+			json_object_new_int(GPOINTER_TO_INT(value)));
+	g_mutex_unlock(&queue_stats.mutex);
+	json_object_object_add(queue, "depth", depths);
+	json_object_object_add(response, "queue", queue);
+
+	stages = json_object_new_object();
+	g_mutex_lock(&pipeline_stats.mutex);
+	json_object_object_add(pipeline, "runs",
+		json_object_new_int(pipeline_stats.runs));
+	json_object_object_add(pipeline, "time_to_usable_ms",
+		json_object_new_int64(pipeline_stats.usable / 1000));
+	json_object_object_add(pipeline, "time_to_usable_avg_ms",
+		json_object_new_int64(pipeline_stats.runs ?
+			pipeline_stats.usable_total / pipeline_stats.runs / 1000 : 0));
+	for (i = 0; i < STAGE_DONE; i++)
+		json_object_object_add(stages, stage_names[i],
+			json_object_new_int64(pipeline_stats.stages[i] / 1000));
+	g_mutex_unlock(&pipeline_stats.mutex);
+	json_object_object_add(pipeline, "stages", stages);
+	json_object_object_add(response, "pipeline", pipeline);
+
+	afb_req_success(request, response, NULL);
+}
+
+static struct pbap_event *get_event_from_value(const char *value)
+{
+	if (!g_strcmp0(value, "status"))
+		return status_event;
+
+	if (!g_strcmp0(value, "contacts_changed"))
+		return contacts_changed_event;
+
+	if (!g_strcmp0(value, "history_changed"))
+		return history_changed_event;
+
+	if (!g_strcmp0(value, "caller_id"))
+		return caller_id_event;
+
+	if (!g_strcmp0(value, "sync_progress"))
+		return sync_progress_event;
+
+	return NULL;
+}
+
+static void subscribe(afb_req_t request)
+{
+	const char *value = afb_req_value(request, "value");
+	struct pbap_event *event;
+	gchar *address;
+	int ret;
+
+	if (!value) {
+		afb_req_fail(request, "failed", "No event");
+		return;
+	}
+
+	event = get_event_from_value(value);
+	if (!event) {
+		afb_req_fail(request, "failed", "Invalid event");
+		return;
+	}
+
+	if (!filter_address(request, &address)) {
+		afb_req_fail(request, "failed", "Invalid filter");
+		return;
+	}
+
+	ret = pbap_event_subscribe(event, request, address);
+	g_free(address);
+	if (ret) {
+		afb_req_fail(request, "failed", "Invalid filter");
+		return;
+	}
+	afb_req_success(request, NULL, NULL);
+
+	if (event == sync_progress_event)
+		g_atomic_int_set(&progress_listeners, TRUE);
+
+	if (event == status_event) {
+		const struct status_snapshot *snap = snapshot_acquire();
+		int i;
+
+		if (!snap->devices->len)
+			pbap_event_push(status_event, status_json(snap, NULL));
+		for (i = 0; i < snap->devices->len; i++)
+			pbap_event_push(status_event, status_json(snap,
+				g_array_index(snap->devices, struct device_status, i).address));
+		snapshot_release();
+	}
+}
+
+static void unsubscribe(afb_req_t request)
+{
+	const char *value = afb_req_value(request, "value");
+	struct pbap_event *event;
+	gchar *address;
+	int ret;
+
+	if (value) {
+		event = get_event_from_value(value);
+		if (!event) {
+			afb_req_fail(request, "failed", "Invalid event");
+			return;
+		}
+		if (!filter_address(request, &address)) {
+			afb_req_fail(request, "failed", "Invalid filter");
+			return;
+		}
+		ret = pbap_event_unsubscribe(event, request, address);
+		g_free(address);
+		if (ret) {
+			afb_req_fail(request, "failed", "Invalid filter");
+			return;
+		}
+	}
+
+	afb_req_success(request, NULL, NULL);
+}
+
+/* returns TRUE if the value stored for key changed from a known one */
+static gboolean update_folder_version(gchar *key, gchar *version)
+{
+	const gchar *old = g_hash_table_lookup(folder_versions, key);
+	gboolean changed = old && g_strcmp0(old, version);
+
+	g_hash_table_replace(folder_versions, key, version);
+
+	return changed;
+}
+
+static gboolean match_address_prefix(gpointer key, gpointer value,
+				     gpointer user_data)
+{
+	return g_str_has_prefix(key, user_data);
 }
 
-static gboolean parse_max_entries_parameter(afb_req_t request, int *max_entries)
+/* versions of the lists of a device, but not that of its database */
+static gboolean match_list_versions(gpointer key, gpointer value,
+				    gpointer user_data)
 {
-	struct json_object *max_obj, *query;
+	return g_str_has_prefix(key, user_data) && g_strcmp0(key, user_data);
+}
 
-	query = afb_req_json(request);
+/* fetch a list the phone reports as changed, unless being fetched */
+static void sync_list(struct pbap_device *dev, const gchar *name)
+{
+	static const gchar *lists[] = { INCOMING, OUTGOING, MISSED, COMBINED };
+	struct pbap_job *job = dev->current_job;
+	gchar *key;
+	int i;
 
-	if (json_object_object_get_ex(query, "max_entries", &max_obj) == TRUE) {
-		if (json_object_is_type(max_obj, json_type_int)) {
-			*max_entries = json_object_get_int(max_obj);
-			if ((*max_entries < 0) || (*max_entries > (2e16-1))) {
-				afb_req_fail(request, "max_entries out of range", NULL);
-				return FALSE;
-			}
-		} else {
-			afb_req_fail(request, "max_entries not integer", NULL);
-			return FALSE;
-		}
+	if (!g_strcmp0(name, CONTACTS))
+		g_clear_pointer(&dev->listing, json_object_put);
+	else
+		g_clear_pointer(&dev->history, json_object_put);
+
+	key = entry_key(dev->address, name, NULL);
+	g_hash_table_foreach_remove(checkpoints, match_address_prefix, key);
+	g_free(key);
+
+	if (job && job->type == JOB_PULL_ALL &&
+	    job->max_entries < 0 && !g_strcmp0(job->list, name))
+		return;
+
+	if (!g_strcmp0(name, CONTACTS)) {
+		contacts_refresh(dev->address, NULL);
+		return;
 	}
 
-	return TRUE;
+	for (i = 0; i < G_N_ELEMENTS(lists); i++) {
+		if (!g_strcmp0(name, lists[i]))
+			history_refresh(dev->address, lists[i]);
+	}
 }
 
-void contacts(afb_req_t request)
+/* replaces a cached string property with its new value */
+static void property_update(gchar **cached, GVariant *value)
 {
-	struct json_object *jresp;
-	const char *cached = NULL;
-	int max_entries = -1;
-
-	if (!connected) {
-		afb_req_fail(request, "not connected", NULL);
+	if (!g_variant_is_of_type(value, G_VARIANT_TYPE_STRING))
 		return;
+
+	g_free(*cached);
+	*cached = g_variant_dup_string(value, NULL);
+}
+
+static void on_phonebook_properties_changed(const gchar *path,
+					    GVariant *changed_properties,
+					    gpointer user_data)
+{
+	struct pbap_device *dev = user_data;
+	const gchar *address = dev->address;
+	gchar *database = NULL;
+	gboolean counter = FALSE;
+	GVariantIter iter;
+	const gchar *key;
+	GVariant *value;
+	gchar *prefix, *list;
+
+	/* only what changed is sent, counters are kept for the version */
+	g_variant_iter_init(&iter, changed_properties);
+	while (g_variant_iter_next(&iter, "{&sv}", &key, &value)) {
+		if (!g_strcmp0(key, "DatabaseIdentifier")) {
+			property_update(&database, value);
+		} else if (!g_strcmp0(key, "Folder")) {
+			property_update(&dev->folder, value);
+		} else if (!g_strcmp0(key, "PrimaryCounter")) {
+			property_update(&dev->primary_counter, value);
+			counter = TRUE;
+		} else if (!g_strcmp0(key, "SecondaryCounter")) {
+			property_update(&dev->secondary_counter, value);
+			counter = TRUE;
+		}
+		g_variant_unref(value);
 	}
 
-	if (!parse_max_entries_parameter(request, &max_entries))
+	/* counters are of the folder selected last */
+	counter = counter && dev->folder &&
+		  dev->primary_counter && dev->secondary_counter;
+
+	if (!database && !counter)
 		return;
 
-	if (max_entries == -1 && !read_cached_value(connected_address, &cached)) {
-		jresp = json_tokener_parse(cached);
-	} else {
-		org_bluez_obex_phonebook_access1_call_select_sync(
-			phonebook, INTERNAL, CONTACTS, NULL, NULL);
-		jresp = get_vcards(max_entries);
+	if (database) {
+		prefix = g_strdup_printf("%s/", address);
+		if (update_folder_version(g_strdup(prefix), database)) {
+			AFB_NOTICE("Phonebook database of %s changed", address);
+			pbap_lru_remove_prefix(entry_cache, prefix);
+			g_hash_table_foreach_remove(folder_versions,
+						    match_list_versions, prefix);
+			g_hash_table_foreach_remove(checkpoints,
+						    match_address_prefix, prefix);
+			sync_list(dev, CONTACTS);
+		}
+		g_free(prefix);
 	}
 
-	afb_req_success(request, jresp, "contacts");
+	if (counter) {
+		list = g_path_get_basename(dev->folder);
+		prefix = entry_key(address, list, NULL);
+		if (update_folder_version(g_strdup(prefix), g_strdup_printf("%s:%s",
+				dev->primary_counter, dev->secondary_counter))) {
+			pbap_lru_remove_prefix(entry_cache, prefix);
+			sync_list(dev, list);
+		}
+		g_free(prefix);
+		g_free(list);
+	}
 }
 
-void entry(afb_req_t request)
+/* signals are delivered to the thread that subscribes to them */
+static gboolean init_dbus_cb(gpointer user_data)
 {
-	struct json_object *handle_obj, *jresp, *query;
-	const gchar *handle;
-	gchar *list = NULL;
+	pbap_obex_init(on_transfer_properties_changed);
 
-	if (!connected) {
-		afb_req_fail(request, "not connected", NULL);
-		return;
+	return G_SOURCE_REMOVE;
+}
+
+static void set_session_state(struct pbap_device *dev, enum session_state state)
+{
+	dev->state = state;
+	if (state == SESSION_CONNECTED && g_strcmp0(default_address, dev->address)) {
+		g_free(default_address);
+		default_address = g_strdup(dev->address);
 	}
+	snapshot_publish();
 
-	query = afb_req_json(request);
+	pbap_event_push(status_event, status_json(snapshot, dev->address));
+}
 
-	if (json_object_object_get_ex(query, "handle", &handle_obj) == TRUE) {
-		if (json_object_is_type(handle_obj, json_type_string)) {
-			handle = json_object_get_string(handle_obj);
-		} else {
-			afb_req_fail(request, "handle not string", NULL);
-			return;
-		}
-	} else {
-		afb_req_fail(request, "no handle", NULL);
-		return;
+static void remove_session(const gchar *spath)
+{
+	g_atomic_int_inc(&live.sessions_removed);
+	pbap_obex_remove_session(spath);
+}
+
+static void attempt_free(struct session_attempt *a)
+{
+	if (a->timer)
+		pbap_loop_source_remove(a->timer);
+	if (a->cancel) {
+		g_cancellable_cancel(a->cancel);
+		g_object_unref(a->cancel);
 	}
+	/* a session created by an abandoned attempt is not left behind */
+	if (a->spath)
+		remove_session(a->spath);
+	g_free(a->spath);
+	g_free(a);
+}
 
-	if (!parse_list_parameter(request, &list))
-		return;
+/* returns the attempt of a D-Bus call, or NULL if it was abandoned */
+static struct session_attempt *attempt_of(GCancellable *cancel)
+{
+	struct session_attempt *a = NULL;
+	struct pbap_device *dev;
+	GHashTableIter iter;
+
+	g_hash_table_iter_init(&iter, devices);
+	while (!a && g_hash_table_iter_next(&iter, NULL, (gpointer *) &dev)) {
+		if (dev->attempt && dev->attempt->cancel == cancel &&
+		    !g_cancellable_is_cancelled(cancel))
+			a = dev->attempt;
+	}
+	g_object_unref(cancel);
+
+	return a;
+}
 
-	org_bluez_obex_phonebook_access1_call_select_sync(
-			phonebook, INTERNAL, list, NULL, NULL);
-	jresp = get_vcard(handle);
+static gboolean attempt_retry_cb(gpointer user_data);
 
-	if (!jresp) {
-		afb_req_fail(request, "invalid handle", NULL);
+static void attempt_failed(struct session_attempt *a, gboolean retry)
+{
+	struct pbap_device *dev = a->dev;
+	guint delay;
+
+	if (a->timer)
+		pbap_loop_source_remove(a->timer);
+	a->timer = 0;
+
+	if (a->spath) {
+		remove_session(a->spath);
+		g_clear_pointer(&a->spath, g_free);
+	}
+
+	if (!retry || a->tries > session_retries) {
+		AFB_ERROR("Failed to set up PBAP session with %s", dev->address);
+		dev->attempt = NULL;
+		attempt_free(a);
+		set_session_state(dev, SESSION_FAILED);
+		scheduler_run_next(dev);
 		return;
 	}
 
-	afb_req_success(request, jresp, "list entry");
+	delay = MIN(session_backoff << MIN(a->tries - 1, 16), SESSION_BACKOFF_MAX);
+	AFB_WARNING("PBAP session with %s failed, retrying in %u s",
+		    dev->address, delay);
+	a->timer = pbap_loop_timeout_add_seconds(delay, attempt_retry_cb, a);
 }
 
-void history(afb_req_t request)
+static void attempt_done(struct session_attempt *a)
 {
-	struct json_object *jresp;
-	gchar *list = NULL;
-	int max_entries = -1;
+	struct pbap_device *dev = a->dev;
 
-	if (!connected) {
-		afb_req_fail(request, "not connected", NULL);
+	/* the session now belongs to the device */
+	dev->session = a->spath;
+	a->spath = NULL;
+	dev->phonebook_watch = pbap_obex_watch_phonebook(dev->session,
+			on_phonebook_properties_changed, dev);
+
+	dev->attempt = NULL;
+	attempt_free(a);
+
+	set_session_state(dev, SESSION_CONNECTED);
+	AFB_NOTICE("PBAP device connected: %s", dev->address);
+
+	numbers_index_async(dev->address, NULL);
+	pipeline_start(dev->address);
+	scheduler_run_next(dev);
+}
+
+static void session_target_cb(GObject *source, GAsyncResult *res,
+			      gpointer user_data)
+{
+	struct session_attempt *a;
+	GError *error = NULL;
+	gchar *target = NULL;
+	gboolean ret;
+
+	ret = pbap_obex_get_target_finish(res, &target, &error);
+	a = attempt_of(user_data);
+	if (!a) {
+		g_free(target);
+		g_clear_error(&error);
 		return;
 	}
 
-	if (!parse_list_parameter(request, &list))
+	if (!ret) {
+		AFB_ERROR("Failed to get session target: %s", error->message);
+		g_error_free(error);
+		attempt_failed(a, TRUE);
 		return;
+	}
 
-	if (!parse_max_entries_parameter(request, &max_entries))
+	if (g_strcmp0(target, PBAP_UUID)) {
+		AFB_ERROR("Device does not support PBAP");
+		g_free(target);
+		attempt_failed(a, FALSE);
 		return;
+	}
+	g_free(target);
 
-	org_bluez_obex_phonebook_access1_call_select_sync(
-			phonebook, INTERNAL, list, NULL, NULL);
-	jresp = get_vcards(max_entries);
-
-	afb_req_success(request, jresp, "call history");
+	attempt_done(a);
 }
 
-static void search(afb_req_t request)
+static void create_session_cb(GObject *source, GAsyncResult *res,
+			      gpointer user_data)
 {
-	struct json_object *query, *val, *results_array, *response;
-	const char *number = NULL;
-	GVariantIter iter;
-	GVariantBuilder *b;
-	GVariant *entry, *filter, *results;
-	gchar *card, *name;
-	int max_entries = -1;
-
-	if (!connected) {
-		afb_req_fail(request, "not connected", NULL);
+	struct session_attempt *a;
+	GError *error = NULL;
+	gchar *spath = NULL;
+	gboolean ret;
+
+	ret = pbap_obex_create_session_finish(res, &spath, &error);
+	if (ret)
+		g_atomic_int_inc(&live.sessions_created);
+	a = attempt_of(user_data);
+	if (!a) {
+		if (ret)
+			remove_session(spath);
+		g_free(spath);
+		g_clear_error(&error);
 		return;
 	}
 
-	query = afb_req_json(request);
-
-	json_object_object_get_ex(query, "number", &val);
-	if (json_object_is_type(val, json_type_string)) {
-		number = json_object_get_string(val);
-	}
-	else {
-		afb_req_fail(request, "no number", NULL);
+	if (!ret) {
+		AFB_ERROR("Failed to create session: %s", error->message);
+		g_error_free(error);
+		attempt_failed(a, TRUE);
 		return;
 	}
 
-	if (!parse_max_entries_parameter(request, &max_entries))
-		return;
+	a->spath = spath;
+	pbap_obex_get_target(spath, a->cancel, session_target_cb,
+			     g_object_ref(a->cancel));
+}
 
-	org_bluez_obex_phonebook_access1_call_select_sync(
-			phonebook, INTERNAL, CONTACTS, NULL, NULL);
+/* the reply of the pending call is dropped once the try is cancelled */
+static gboolean attempt_deadline_cb(gpointer user_data)
+{
+	struct session_attempt *a = user_data;
 
-	b = g_variant_builder_new (G_VARIANT_TYPE ("a{sv}"));
-	g_variant_builder_add(b, "{sv}", "Order", g_variant_new_string("indexed"));
-	g_variant_builder_add(b, "{sv}", "Offset", g_variant_new_uint16(0));
-	g_variant_builder_add(b, "{sv}", "Format", g_variant_new_string("vcard30"));
-	if (max_entries >= 0)
-		g_variant_builder_add(b, "{sv}", "MaxCount", g_variant_new_uint16((guint16)max_entries));
-	filter = g_variant_builder_end(b);
+	AFB_WARNING("PBAP session with %s timed out", a->dev->address);
+	a->timer = 0;
+	g_cancellable_cancel(a->cancel);
+	attempt_failed(a, TRUE);
 
-	org_bluez_obex_phonebook_access1_call_search_sync(
-			phonebook, "number", number, filter, &results, NULL, NULL);
+	return G_SOURCE_REMOVE;
+}
 
-	g_variant_builder_unref(b);
+static void attempt_try(struct session_attempt *a)
+{
+	a->tries++;
+	if (a->cancel) {
+		g_cancellable_cancel(a->cancel);
+		g_object_unref(a->cancel);
+	}
+	a->cancel = g_cancellable_new();
 
-	results_array = json_object_new_array();
-	g_variant_iter_init(&iter, results);
-	while ((entry = g_variant_iter_next_value(&iter))) {
-		g_variant_get(entry, "(ss)", &card, &name);
-		g_variant_unref(entry);
-		json_object *result_obj = json_object_new_object();
-		json_object *card_str = json_object_new_string(card);
-		json_object *name_str = json_object_new_string(name);
-		json_object_object_add(result_obj, "handle", card_str);
-		json_object_object_add(result_obj, "name", name_str);
-		json_object_array_add(results_array, result_obj);
-		g_free(card);
-		g_free(name);
+	/* a failure to reach the bus is retried with the session */
+	if (!pbap_obex_init(on_transfer_properties_changed)) {
+		attempt_failed(a, TRUE);
+		return;
 	}
-	response = json_object_new_object();
-	json_object_object_add(response, "results", results_array);
 
-	afb_req_success(request, response, NULL);
+	a->timer = pbap_loop_timeout_add_seconds(session_timeout, attempt_deadline_cb, a);
+
+	/*
+	 * The call itself is not cancelled, so that a session created for
+	 * a try given up meanwhile is known and removed.
+	 */
+	pbap_obex_create_session(a->dev->address, NULL, create_session_cb,
+				 g_object_ref(a->cancel));
 }
 
-static void status(afb_req_t request)
+static gboolean attempt_retry_cb(gpointer user_data)
 {
-	struct json_object *response, *status;
+	struct session_attempt *a = user_data;
 
-	response = json_object_new_object();
-	g_mutex_lock(&connected_mutex);
-	status = json_object_new_boolean(connected);
-	g_mutex_unlock(&connected_mutex);
-	json_object_object_add(response, "connected", status);
+	a->timer = 0;
+	attempt_try(a);
 
-	afb_req_success(request, response, NULL);
+	return G_SOURCE_REMOVE;
 }
 
-static void subscribe(afb_req_t request)
+/* set up a PBAP session in the background, status events report it */
+static void session_connect(const gchar *address)
 {
-	const char *value = afb_req_value(request, "value");
+	struct pbap_device *dev = g_hash_table_lookup(devices, address);
 
-	if (!value) {
-		afb_req_fail(request, "failed", "No event");
+	if (dev && (dev->state == SESSION_CONNECTED || dev->attempt))
 		return;
-	}
-
-	if (!g_strcmp0(value, "status")) {
-		afb_req_subscribe(request, status_event);
-		afb_req_success(request, NULL, NULL);
 
-		struct json_object *event, *status;
-		event = json_object_new_object();
-		g_mutex_lock(&connected_mutex);
-		status = json_object_new_boolean(connected);
-		g_mutex_unlock(&connected_mutex);
-		json_object_object_add(event, "connected", status);
-		afb_event_push(status_event, event);
-	} else {
-		afb_req_fail(request, "failed", "Invalid event");
+	if (!dev) {
+		dev = device_new(address);
+		g_hash_table_insert(devices, dev->address, dev);
 	}
+
+	dev->attempt = g_new0(struct session_attempt, 1);
+	dev->attempt->dev = dev;
+	set_session_state(dev, SESSION_CONNECTING);
+	attempt_try(dev->attempt);
 }
 
-static void unsubscribe(afb_req_t request)
+/* the default device falls back to any other connected one */
+static void default_device_reset(void)
 {
-	const char *value = afb_req_value(request, "value");
-	if (value) {
-		if (!g_strcmp0(value, "status")) {
-			afb_req_unsubscribe(request, status_event);
-		} else {
-			afb_req_fail(request, "failed", "Invalid event");
-			return;
-		}
+	struct pbap_device *dev;
+	GHashTableIter iter;
+
+	g_clear_pointer(&default_address, g_free);
+	g_hash_table_iter_init(&iter, devices);
+	while (!default_address &&
+	       g_hash_table_iter_next(&iter, NULL, (gpointer *) &dev)) {
+		if (dev->state == SESSION_CONNECTED)
+			default_address = g_strdup(dev->address);
 	}
-
-	afb_req_success(request, NULL, NULL);
 }
 
-static gboolean init_session(const gchar *address)
+/*
+ * Tear down the session of a device that went away. Pending D-Bus
+ * calls are cancelled and transfers aborted, so every queued or
+ * running job fails right away, and the device is freed with the
+ * last of them.
+ */
+static void session_disconnect(const gchar *address)
 {
-	GVariant *args;
-	GVariantBuilder *b;
-	const gchar *target;
-	gchar *spath;
+	struct pbap_device *dev = g_hash_table_lookup(devices, address);
+	GHashTableIter iter;
+	gchar *tpath;
+	GList *xfers, *l;
 
-	xfer_queue = g_hash_table_new(g_str_hash, g_str_equal);
-	xfer_complete = g_hash_table_new(g_str_hash, g_str_equal);
+	if (!dev)
+		return;
 
-	obj_manager = object_manager_client_new_for_bus_sync(
-			G_BUS_TYPE_SESSION,
-			G_DBUS_OBJECT_MANAGER_CLIENT_FLAGS_NONE,
-			"org.bluez.obex", "/", NULL, NULL);
+	g_hash_table_remove(devices, address);
+	if (!g_strcmp0(default_address, address))
+		default_device_reset();
+	snapshot_publish();
 
-	if (obj_manager == NULL) {
-		AFB_ERROR("Failed to create object manager");
-		return FALSE;
+	if (dev->attempt) {
+		attempt_free(dev->attempt);
+		dev->attempt = NULL;
 	}
+	if (dev->phonebook_watch)
+		pbap_obex_unwatch(dev->phonebook_watch);
 
-	g_signal_connect(obj_manager,
-			"interface-proxy-properties-changed",
-			G_CALLBACK (on_interface_proxy_properties_changed),
-			NULL);
+	set_session_state(dev, SESSION_DISCONNECTED);
+	pbap_numbers_remove(address);
+	AFB_NOTICE("PBAP device disconnected: %s", address);
 
-	client = org_bluez_obex_client1_proxy_new_for_bus_sync(
-			G_BUS_TYPE_SESSION, G_DBUS_PROXY_FLAGS_NONE,
-			"org.bluez.obex", "/org/bluez/obex", NULL, NULL);
+	g_cancellable_cancel(dev->cancel);
 
-	if (client == NULL) {
-		AFB_ERROR("Failed to create client proxy");
-		return FALSE;
-	}
+	g_hash_table_iter_init(&iter, dev->xfers);
+	while (g_hash_table_iter_next(&iter, (gpointer *) &tpath, NULL))
+		pbap_obex_cancel_transfer(tpath);
 
-	b = g_variant_builder_new (G_VARIANT_TYPE ("a{sv}"));
-	g_variant_builder_add(b, "{sv}", "Target", g_variant_new_string("pbap"));
-	args = g_variant_builder_end(b);
+	if (dev->session)
+		remove_session(dev->session);
 
-	org_bluez_obex_client1_call_create_session_sync(
-			client, address, args, &spath, NULL, NULL);
+	/* status changes of its transfers are no longer looked up */
+	xfers = g_hash_table_get_values(dev->xfers);
+	g_atomic_int_add(&live.transfers, -(gint) g_hash_table_size(dev->xfers));
+	g_hash_table_remove_all(dev->xfers);
+	for (l = xfers; l; l = l->next)
+		transfer_done(l->data, FALSE);
+	g_list_free(xfers);
 
-	session = org_bluez_obex_session1_proxy_new_for_bus_sync(
-			G_BUS_TYPE_SESSION, G_DBUS_PROXY_FLAGS_NONE,
-			"org.bluez.obex", spath, NULL, NULL);
+	/* fails the jobs still queued */
+	scheduler_run_next(dev);
+	device_unref(dev);
+}
 
-	target = org_bluez_obex_session1_get_target(session);
-	if (g_strcmp0(target, PBAP_UUID) != 0) {
-		AFB_ERROR("Device does not support PBAP");
-		return FALSE;
-	}
+static void bt_device_free(gpointer data)
+{
+	struct bt_device *bt = data;
 
-	phonebook = org_bluez_obex_phonebook_access1_proxy_new_for_bus_sync(
-			G_BUS_TYPE_SESSION, G_DBUS_PROXY_FLAGS_NONE,
-			"org.bluez.obex", spath, NULL, NULL);
+	if (bt->debounce)
+		pbap_loop_source_remove(bt->debounce);
+	g_free(bt->address);
+	g_free(bt);
+}
 
-	return TRUE;
+static void bt_change_free(struct bt_change *change)
+{
+	g_free(change->device);
+	g_free(change->action);
+	g_free(change->address);
+	g_free(change);
 }
 
-static gboolean is_pbap_dev_and_init(struct json_object *dev)
+/* parse a Bluetooth-Manager device, only what the binding cares about */
+static struct bt_change *bt_change_new(struct json_object *object,
+				       const gchar *action)
 {
-	struct json_object *jresp, *props = NULL, *val = NULL;
+	struct json_object *props = NULL, *val = NULL;
+	struct bt_change *change;
+	const gchar *uuid;
 	int i;
 
-	json_object_object_get_ex(dev, "properties", &props);
-	if (!props)
-		return FALSE;
+	if (!json_object_object_get_ex(object, "device", &val))
+		return NULL;
 
-	json_object_object_get_ex(props, "connected", &val);
-	if (!val || !json_object_get_boolean(val))
-		return FALSE;
+	change = g_new0(struct bt_change, 1);
+	change->device = g_strdup(json_object_get_string(val));
+	change->action = g_strdup(action);
+	change->connected = -1;
+	change->pbap = -1;
 
-	json_object_object_get_ex(props, "uuids", &val);
-	for (i = 0; i < json_object_array_length(val); i++) {
-		const char *uuid = json_object_get_string(json_object_array_get_idx(val, i));
-		const char *address = NULL;
-		struct json_object *val1 = NULL;
+	json_object_object_get_ex(object, "properties", &props);
+	if (json_object_object_get_ex(props, "address", &val))
+		change->address = g_strdup(json_object_get_string(val));
+
+	if (json_object_object_get_ex(props, "connected", &val))
+		change->connected = json_object_get_boolean(val);
+
+	if (json_object_object_get_ex(props, "uuids", &val)) {
+		change->pbap = FALSE;
+		for (i = 0; i < json_object_array_length(val); i++) {
+			uuid = json_object_get_string(json_object_array_get_idx(val, i));
+			if (!g_strcmp0(PBAP_UUID, uuid))
+				change->pbap = TRUE;
+		}
+	}
 
-		if (g_strcmp0(PBAP_UUID, uuid))
-			continue;
+	return change;
+}
 
-		json_object_object_get_ex(props, "address", &val1);
-		address = json_object_get_string(val1);
+static gboolean bt_connect_cb(gpointer user_data)
+{
+	struct bt_device *bt = user_data;
 
-		if (!address)
-			return FALSE;
+	bt->debounce = 0;
+	session_connect(bt->address);
 
-		if (init_session(address)) {
-			jresp = json_object_new_object();
+	return G_SOURCE_REMOVE;
+}
 
-			g_mutex_lock(&connected_mutex);
-			if (connected_address)
-				g_free(connected_address);
-			connected_address = g_strdup(address);
+/*
+ * A connect only starts a session once the device stayed connected
+ * for the debounce delay, a disconnect tears it down right away.
+ */
+static void bt_device_update(struct bt_device *bt)
+{
+	if (bt->debounce) {
+		pbap_loop_source_remove(bt->debounce);
+		bt->debounce = 0;
+	}
 
-			connected = TRUE;
-			json_object_object_add(jresp, "connected",
-				json_object_new_boolean(connected));
-			g_mutex_unlock(&connected_mutex);
+	if (bt->connected && bt->pbap)
+		bt->debounce = pbap_loop_timeout_add(session_debounce, bt_connect_cb, bt);
+	else
+		session_disconnect(bt->address);
+}
 
-			afb_event_push(status_event, jresp);
+static gboolean bt_change_cb(gpointer user_data)
+{
+	struct bt_change *change = user_data;
+	struct bt_device *bt = g_hash_table_lookup(bt_devices, change->device);
 
-			json_object_object_get_ex(dev, "device", &val1);
-			AFB_NOTICE("PBAP device connected: %s", json_object_get_string(val1));
+	if (!g_strcmp0(change->action, "removed")) {
+		if (bt) {
+			session_disconnect(bt->address);
+			g_hash_table_remove(bt_devices, change->device);
+		}
+		bt_change_free(change);
+		return G_SOURCE_REMOVE;
+	}
 
-			/* probably should be made async */
-			org_bluez_obex_phonebook_access1_call_select_sync(
-				phonebook, INTERNAL, CONTACTS, NULL, NULL);
-			update_or_insert(address,
-				json_object_to_json_string_ext(get_vcards(-1),
-				JSON_C_TO_STRING_PLAIN));
+	if (!bt) {
+		bt = g_new0(struct bt_device, 1);
+		bt->address = device_to_address(change->device);
+		g_hash_table_insert(bt_devices, g_strdup(change->device), bt);
+	}
 
-			return TRUE;
-		}
-		break;
+	if (change->address && g_strcmp0(bt->address, change->address)) {
+		g_free(bt->address);
+		bt->address = g_strdup(change->address);
 	}
 
-	return FALSE;
+	if (change->pbap >= 0)
+		bt->pbap = change->pbap;
+	if (change->connected >= 0)
+		bt->connected = change->connected;
+
+	/* other properties do not change the session */
+	if (change->pbap >= 0 || change->connected >= 0)
+		bt_device_update(bt);
+
+	bt_change_free(change);
+
+	return G_SOURCE_REMOVE;
+}
+
+/* the device table is only touched from the main loop */
+static void bt_change_post(struct json_object *object, const gchar *action)
+{
+	struct bt_change *change = bt_change_new(object, action);
+
+	if (change)
+		pbap_loop_post(bt_change_cb, change);
 }
 
 static void discovery_result_cb(void *closure, struct json_object *result,
@@ -684,7 +3326,7 @@ static void discovery_result_cb(void *closure, struct json_object *result,
 				afb_api_t api)
 {
 	enum json_type type;
-	struct json_object *dev, *tmp;
+	struct json_object *tmp;
 	int i;
 
 	if (!json_object_object_get_ex(result, "devices", &tmp))
@@ -694,11 +3336,32 @@ static void discovery_result_cb(void *closure, struct json_object *result,
 	if (type != json_type_array)
 		return;
 
-	for (i = 0; i < json_object_array_length(tmp); i++) {
-		dev = json_object_array_get_idx(tmp, i);
-		if (is_pbap_dev_and_init(dev))
-			return;
-	}
+	for (i = 0; i < json_object_array_length(tmp); i++)
+		bt_change_post(json_object_array_get_idx(tmp, i), "added");
+}
+
+static void caller_id_subscribe_cb(void *closure, struct json_object *result,
+				   const char *error, const char *info,
+				   afb_api_t api)
+{
+	if (error)
+		AFB_WARNING("No caller_id events, failed to subscribe to %s: %s",
+			    caller_id_source, error);
+}
+
+static void init_caller_id(afb_api_t api)
+{
+	struct json_object *args;
+	const gchar *event;
+
+	if (!*caller_id_api)
+		return;
+
+	event = caller_id_source + strlen(caller_id_api) + 1;
+	args = json_object_new_object();
+	json_object_object_add(args, "value", json_object_new_string(event));
+	afb_api_call(api, caller_id_api, "subscribe", args,
+		     caller_id_subscribe_cb, NULL);
 }
 
 static void init_bt(afb_api_t api)
@@ -713,33 +3376,141 @@ static void init_bt(afb_api_t api)
 	afb_api_call(api, "Bluetooth-Manager", "managed_objects", args, discovery_result_cb, NULL);
 }
 
+static gint64 get_config_int(GKeyFile *conf, const gchar *group,
+			     const gchar *key, gint64 def)
+{
+	GError *error = NULL;
+	gint64 val;
+
+	val = g_key_file_get_int64(conf, group, key, &error);
+	if (error) {
+		g_error_free(error);
+		return def;
+	}
+
+	if (val < 0) {
+		AFB_WARNING("Ignoring negative %s/%s in %s", group, key, CONFIG_FILE);
+		return def;
+	}
+
+	return val;
+}
+
+static void load_config(void)
+{
+	GKeyFile *conf = g_key_file_new();
+	gchar *codec, *event;
+
+	if (g_key_file_load_from_file(conf, CONFIG_FILE, G_KEY_FILE_NONE, NULL)) {
+		cache_config.max_age = get_config_int(conf, "cache", "max_age",
+						      CACHE_MAX_AGE_DEFAULT);
+		cache_config.write_delay = get_config_int(conf, "cache", "write_delay",
+							  WRITE_DELAY_DEFAULT);
+		cache_config.memory_budget = get_config_int(conf, "cache", "memory_budget",
+							    MEMORY_BUDGET_DEFAULT);
+		cache_config.disk_budget = get_config_int(conf, "cache", "disk_budget",
+							  DISK_BUDGET_DEFAULT);
+		entry_cache_size = get_config_int(conf, "cache", "entries",
+						  ENTRY_CACHE_SIZE_DEFAULT);
+		entry_cache_bytes = get_config_int(conf, "cache", "entry_bytes",
+						   ENTRY_CACHE_BYTES_DEFAULT);
+
+		codec = g_key_file_get_string(conf, "cache", "codec", NULL);
+		if (codec && !pbap_codec_from_string(codec, &cache_config.codec))
+			AFB_WARNING("Unsupported cache codec '%s'", codec);
+		g_free(codec);
+
+		session_timeout = get_config_int(conf, "session", "timeout",
+						 SESSION_TIMEOUT_DEFAULT);
+		session_retries = get_config_int(conf, "session", "retries",
+						 SESSION_RETRIES_DEFAULT);
+		session_backoff = get_config_int(conf, "session", "backoff",
+						 SESSION_BACKOFF_DEFAULT);
+		if (!session_timeout)
+			session_timeout = SESSION_TIMEOUT_DEFAULT;
+		session_debounce = get_config_int(conf, "session", "debounce",
+						  SESSION_DEBOUNCE_DEFAULT);
+
+		queue_depth = get_config_int(conf, "queue", "depth",
+					     QUEUE_DEPTH_DEFAULT);
+		queue_client = get_config_int(conf, "queue", "client",
+					      QUEUE_CLIENT_DEFAULT);
+
+		timeouts.contacts = get_config_int(conf, "timeout", "contacts",
+						   TIMEOUT_CONTACTS_DEFAULT);
+		timeouts.history = get_config_int(conf, "timeout", "history",
+						  TIMEOUT_HISTORY_DEFAULT);
+		timeouts.entry = get_config_int(conf, "timeout", "entry",
+						TIMEOUT_ENTRY_DEFAULT);
+		timeouts.search = get_config_int(conf, "timeout", "search",
+						 TIMEOUT_SEARCH_DEFAULT);
+		timeouts.listing = get_config_int(conf, "timeout", "listing",
+						  TIMEOUT_LISTING_DEFAULT);
+
+		sync_chunk = get_config_int(conf, "sync", "chunk",
+					    SYNC_CHUNK_DEFAULT);
+		sync_latency = get_config_int(conf, "sync", "latency",
+					      SYNC_LATENCY_DEFAULT);
+		sync_checkpoint_age = get_config_int(conf, "sync", "max_age",
+						     SYNC_CHECKPOINT_AGE_DEFAULT);
+
+		loop_workers = get_config_int(conf, "loop", "workers",
+					      LOOP_WORKERS_DEFAULT);
+	}
+
+	caller_id_api = g_key_file_get_string(conf, "caller_id", "api", NULL);
+	if (!caller_id_api)
+		caller_id_api = g_strdup(CALLER_ID_API_DEFAULT);
+
+	event = g_key_file_get_string(conf, "caller_id", "event", NULL);
+	caller_id_source = g_strdup_printf("%s/%s", caller_id_api,
+					   event ? event : CALLER_ID_EVENT_DEFAULT);
+	g_free(event);
+
+	g_key_file_free(conf);
+}
+
 static const afb_verb_t binding_verbs[] = {
 	{ .verb = "contacts",	.callback = contacts,		.info = "List contacts" },
+	{ .verb = "listing",	.callback = listing,		.info = "List contact handles and names" },
 	{ .verb = "entry",	.callback = entry,		.info = "List call entry" },
 	{ .verb = "history",	.callback = history,		.info = "List call history" },
 	{ .verb = "search",	.callback = search,		.info = "Search for entry" },
 	{ .verb = "status",	.callback = status,		.info = "Get status" },
+	{ .verb = "metrics",	.callback = metrics,		.info = "Get performance metrics" },
 	{ .verb = "subscribe",	.callback = subscribe,		.info = "Subscribe to events" },
 	{ .verb = "unsubscribe",.callback = unsubscribe,	.info = "Unsubscribe to events" },
 	{ }
 };
 
-static void *main_loop_thread(void *unused)
-{
-	GMainLoop *loop = g_main_loop_new(NULL, FALSE);
-	g_main_loop_run(loop);
-
-	return NULL;
-}
-
 static int init(afb_api_t api)
 {
 	AFB_NOTICE("PBAP binding init");
 
-	pthread_t tid;
 	int ret = 0;
 
-	status_event = afb_daemon_make_event("status");
+	load_config();
+
+	devices = g_hash_table_new(g_str_hash, g_str_equal);
+	snapshot_publish();
+	pbap_loop_init(loop_workers);
+	bt_devices = g_hash_table_new_full(g_str_hash, g_str_equal,
+					   g_free, bt_device_free);
+	queue_stats.depths = g_hash_table_new_full(g_str_hash, g_str_equal,
+						   g_free, NULL);
+	folder_versions = g_hash_table_new_full(g_str_hash, g_str_equal,
+						g_free, g_free);
+	checkpoints = g_hash_table_new_full(g_str_hash, g_str_equal,
+					    g_free, checkpoint_free);
+	entry_cache = pbap_lru_new(entry_cache_size, entry_cache_bytes);
+	pbap_cache_init(&cache_config);
+	pbap_link_init(sync_chunk, sync_latency);
+
+	status_event = pbap_event_new("status", NULL);
+	contacts_changed_event = pbap_event_new("contacts_changed", pbap_delta_merge);
+	history_changed_event = pbap_event_new("history_changed", pbap_delta_merge);
+	caller_id_event = pbap_event_new("caller_id", NULL);
+	sync_progress_event = pbap_event_new("sync_progress", NULL);
 
 	ret = afb_daemon_require_api("Bluetooth-Manager", 1);
 	if (ret) {
@@ -747,10 +3518,9 @@ static int init(afb_api_t api)
 		return -1;
 	}
 
-	/* Start the main loop thread */
-	pthread_create(&tid, NULL, main_loop_thread, NULL);
-
+	pbap_loop_post(init_dbus_cb, NULL);
 	init_bt(api);
+	init_caller_id(api);
 
 	return ret;
 }
@@ -758,52 +3528,55 @@ static int init(afb_api_t api)
 
 static void process_connection_event(afb_api_t api, struct json_object *object)
 {
-	struct json_object *jresp, *val = NULL, *props = NULL;
-	const char *action, *device;
+	struct json_object *val = NULL;
 
 	json_object_object_get_ex(object, "action", &val);
 	if (!val)
 		return;
-	action = json_object_get_string(val);
-	if (g_strcmp0("changed", action))
-		return;
 
-	json_object_object_get_ex(object, "properties", &props);
-	if (!props)
-		return;
+	bt_change_post(object, json_object_get_string(val));
+}
 
-	json_object_object_get_ex(props, "connected", &val);
-	if (!val)
-		return;
+/* resolve the caller locally, so it is known as soon as the phone rings */
+static void process_incoming_call(struct json_object *object)
+{
+	struct json_object *jresp = NULL, *val = NULL;
+	const struct status_snapshot *snap;
+	const gchar *address;
+	const char *number;
+	int i;
 
-	if (json_object_get_boolean(val)) {
-		struct json_object *args = json_object_new_object();
-		afb_api_call(api, "Bluetooth-Manager", "managed_objects",
-			     args, discovery_result_cb, NULL);
+	if (!json_object_object_get_ex(object, "clip", &val) ||
+	    !json_object_is_type(val, json_type_string))
 		return;
-	}
-
-	json_object_object_get_ex(object, "device", &val);
-	if (!val)
+	number = json_object_get_string(val);
+	if (!*number)
 		return;
 
-	device = json_object_get_string(val);
-	jresp = json_object_new_object();
-
-	g_mutex_lock(&connected_mutex);
-	connected = FALSE;
-	json_object_object_add(jresp, "connected", json_object_new_boolean(connected));
-	g_mutex_unlock(&connected_mutex);
+	/* the call is not tied to a device, the default one is tried first */
+	snap = snapshot_acquire();
+	for (i = 0; i < snap->devices->len && !jresp; i++) {
+		address = g_array_index(snap->devices, struct device_status, i).address;
+		jresp = pbap_numbers_lookup(address, number);
+		if (jresp)
+			json_object_object_add(jresp, "address",
+				json_object_new_string(address));
+	}
+	snapshot_release();
 
-	afb_event_push(status_event, jresp);
+	if (!jresp)
+		jresp = json_object_new_object();
+	json_object_object_add(jresp, "number", json_object_new_string(number));
 
-	AFB_NOTICE("PBAP device disconnected: %s", device);
+	pbap_event_push(caller_id_event, jresp);
 }
 
 static void onevent(afb_api_t api, const char *event, struct json_object *object)
 {
 	if (!g_ascii_strcasecmp(event, "Bluetooth-Manager/device_changes"))
 		process_connection_event(api, object);
+	else if (!g_strcmp0(event, caller_id_source))
+		process_incoming_call(object);
 	else
 		AFB_ERROR("Unsupported event: %s\n", event);
 }
@@ -0,0 +1,827 @@
+/*
+ * Copyright (C) 2018 Konsulko Group
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#define _GNU_SOURCE
+#include <errno.h>
+#include <glib.h>
+#include <json-c/json.h>
+#include <json-c/printbuf.h>
+#include <string.h>
+
+#define AFB_BINDING_VERSION 3
+#include <afb/afb-binding.h>
+
+#include "bluetooth-pbap-cache.h"
+#include "bluetooth-pbap-loop.h"
+#include "bluetooth-pbap-persist.h"
+
+/* persisted sizes and last use of cached devices, for eviction */
+#define INDEX_KEY	"bluetooth-pbap-cache-index"
+
+/*
+ * Contacts of one device, the vCard text only, NULL once evicted
+ * from memory. The timestamp is the monotonic time
+ * of the last refresh, or 0 when the contacts were loaded from
+ * persistence and their age is unknown.
+ */
+struct contacts_cache {
+	gchar *address;
+	GBytes *vcards;
+	gchar *digest;
+	gint64 timestamp;
+	gint64 last_used;
+	gsize disk_bytes;
+	gboolean refreshing;
+	GList link;
+};
+
+static struct pbap_cache_config config;
+
+/* address -> struct contacts_cache, most recently used first in cache_lru */
+static GHashTable *caches;
+static GQueue cache_lru = G_QUEUE_INIT;
+static gsize memory_used;
+static gsize disk_used;
+static guint64 memory_evictions;
+static guint64 disk_evictions;
+static gboolean index_loaded;
+static gboolean index_dirty;
+static GMutex cache_mutex;
+
+/* cost and effect of the codec used for persisted contacts */
+struct codec_metrics {
+	guint64 encoded;
+	guint64 raw_bytes;
+	guint64 encoded_bytes;
+	gint64 encode_time;
+	guint64 decoded;
+	gint64 decode_time;
+};
+
+static struct codec_metrics codec_metrics;
+static GMutex metrics_mutex;
+
+/*
+ * Serialized contacts waiting to be written to persistence, keyed by address.
+ * A newer result for the same device replaces the pending one, and
+ * no new batch is started until the previous one has completed.
+ */
+static GHashTable *persist_pending;
+static GHashTable *persist_digests;
+static guint persist_timer;
+static guint persist_writes;
+static guint64 persist_written;
+static guint64 persist_coalesced;
+static guint64 persist_skipped;
+static GMutex persist_mutex;
+
+static void persist_done(gboolean written);
+static void persist_forget(const gchar *address);
+
+static void persist_store_cb(const gchar *key, const char *error,
+			     gpointer user_data)
+{
+	if (error)
+		persist_forget(key);
+
+	persist_done(!error);
+}
+
+static void delete_cb(void *closure, struct json_object *result,
+		      const char *error, const char *info, afb_api_t api)
+{
+	gchar *key = closure;
+
+	if (error)
+		AFB_ERROR("Failed to delete persistence value '%s': %s", key, error);
+	else
+		AFB_DEBUG("Deleted persistence value '%s'", key);
+
+	g_free(key);
+}
+
+static int read_cached_value(const char *key, const char **data)
+{
+	json_object *response, *query;
+	int ret;
+
+	query = json_object_new_object();
+	json_object_object_add(query, "key", json_object_new_string(key));
+
+	ret = afb_service_call_sync("persistence", "read", query, &response, NULL, NULL);
+	if (!ret) {
+		json_object *val = NULL;
+
+		json_object_object_get_ex(response, "value", &val);
+		if (!val)
+			return -EINVAL;
+
+		*data = g_strdup(json_object_get_string(val));
+	}
+
+	json_object_get(response);
+
+	return ret;
+}
+
+static struct json_object *cache_decode(const char *value)
+{
+	struct json_object *jresp;
+	gint64 start = g_get_monotonic_time();
+
+	jresp = pbap_codec_decode_json(value);
+
+	g_mutex_lock(&metrics_mutex);
+	codec_metrics.decoded++;
+	codec_metrics.decode_time += g_get_monotonic_time() - start;
+	g_mutex_unlock(&metrics_mutex);
+
+	return jresp;
+}
+
+static void cache_free(gpointer data)
+{
+	struct contacts_cache *c = data;
+
+	g_free(c->address);
+	if (c->vcards)
+		g_bytes_unref(c->vcards);
+	g_free(c->digest);
+	g_free(c);
+}
+
+/* cache_mutex must be held for all cache_* helpers below */
+static struct contacts_cache *cache_new(const gchar *address)
+{
+	struct contacts_cache *c = g_new0(struct contacts_cache, 1);
+
+	c->address = g_strdup(address);
+	c->link.data = c;
+	g_hash_table_insert(caches, c->address, c);
+
+	return c;
+}
+
+static struct contacts_cache *cache_get(const gchar *address)
+{
+	struct contacts_cache *c = g_hash_table_lookup(caches, address);
+
+	if (!c) {
+		c = cache_new(address);
+		g_queue_push_tail_link(&cache_lru, &c->link);
+	}
+
+	return c;
+}
+
+static void cache_remove(struct contacts_cache *c)
+{
+	g_queue_unlink(&cache_lru, &c->link);
+	g_hash_table_remove(caches, c->address);
+}
+
+static void cache_touch(struct contacts_cache *c)
+{
+	c->last_used = g_get_real_time() / G_USEC_PER_SEC;
+
+	if (cache_lru.head == &c->link)
+		return;
+
+	g_queue_unlink(&cache_lru, &c->link);
+	g_queue_push_head_link(&cache_lru, &c->link);
+	index_dirty = TRUE;
+}
+
+static gsize cache_memory_bytes(struct contacts_cache *c)
+{
+	return c->vcards ? g_bytes_get_size(c->vcards) : 0;
+}
+
+static void cache_set_vcards(struct contacts_cache *c, GBytes *vcards)
+{
+	memory_used -= cache_memory_bytes(c);
+	if (c->vcards)
+		g_bytes_unref(c->vcards);
+
+	c->vcards = vcards ? g_bytes_ref(vcards) : NULL;
+	memory_used += cache_memory_bytes(c);
+}
+
+/*
+ * A reply of its own for each requester since json-c reference counts
+ * are not atomic, copied from the vCard text without parsing.
+ */
+static struct json_object *cache_response(struct contacts_cache *c)
+{
+	struct json_object *jresp = json_object_new_object();
+	gsize len;
+	const gchar *data = g_bytes_get_data(c->vcards, &len);
+
+	json_object_object_add(jresp, "vcards",
+			       json_object_new_string_len(data, len));
+
+	return jresp;
+}
+
+/* the vCard text of a contacts response, or NULL */
+static GBytes *vcards_new(struct json_object *response)
+{
+	struct json_object *jvcards = NULL;
+
+	if (!json_object_object_get_ex(response, "vcards", &jvcards) ||
+	    !json_object_is_type(jvcards, json_type_string))
+		return NULL;
+
+	return g_bytes_new(json_object_get_string(jvcards),
+			   json_object_get_string_len(jvcards));
+}
+
+static void cache_set_disk_bytes(struct contacts_cache *c, gsize bytes)
+{
+	disk_used += bytes - c->disk_bytes;
+	c->disk_bytes = bytes;
+	index_dirty = TRUE;
+}
+
+static gboolean cache_is_stale(struct contacts_cache *c)
+{
+	return !c->timestamp || g_get_monotonic_time() - c->timestamp >
+		config.max_age * G_USEC_PER_SEC;
+}
+
+/*
+ * Drop least recently used devices until both budgets are met, first
+ * their contacts in memory, then the persisted ones. Returns the
+ * addresses whose persisted contacts are to be deleted.
+ */
+static GSList *cache_evict(void)
+{
+	struct contacts_cache *c;
+	GSList *deleted = NULL;
+	GList *l, *prev;
+
+	for (l = cache_lru.tail; l && l != cache_lru.head && config.memory_budget &&
+	     memory_used > config.memory_budget; l = prev) {
+		c = l->data;
+		prev = l->prev;
+
+		if (!c->vcards)
+			continue;
+
+		cache_set_vcards(c, NULL);
+		memory_evictions++;
+
+		if (!c->disk_bytes && !c->refreshing)
+			cache_remove(c);
+	}
+
+	for (l = cache_lru.tail; l && l != cache_lru.head && config.disk_budget &&
+	     disk_used > config.disk_budget; l = prev) {
+		c = l->data;
+		prev = l->prev;
+
+		if (!c->disk_bytes)
+			continue;
+
+		deleted = g_slist_prepend(deleted, g_strdup(c->address));
+		cache_set_disk_bytes(c, 0);
+		disk_evictions++;
+
+		if (!c->vcards && !c->refreshing)
+			cache_remove(c);
+	}
+
+	return deleted;
+}
+
+static void persist_discard(const gchar *address)
+{
+	g_mutex_lock(&persist_mutex);
+	g_hash_table_remove(persist_pending, address);
+	g_hash_table_remove(persist_digests, address);
+	g_mutex_unlock(&persist_mutex);
+}
+
+/* delete evicted contacts from persistence, with cache_mutex released */
+static void cache_delete(GSList *deleted)
+{
+	struct json_object *query;
+	GSList *l;
+
+	for (l = deleted; l; l = l->next) {
+		gchar *address = l->data;
+
+		AFB_INFO("Evicting persisted contacts of %s", address);
+		persist_discard(address);
+
+		query = json_object_new_object();
+		json_object_object_add(query, "key", json_object_new_string(address));
+		afb_service_call("persistence", "delete", query, delete_cb, address);
+	}
+
+	g_slist_free(deleted);
+}
+
+static void cache_persist(const gchar *address, GBytes *text);
+
+static GBytes *text_new(struct json_object *jso)
+{
+	const char *text = json_object_to_json_string_ext(jso, JSON_C_TO_STRING_PLAIN);
+
+	return g_bytes_new(text, strlen(text));
+}
+
+/* queue the index for the write-behind if it changed */
+static void index_sync(void)
+{
+	struct json_object *index, *jentry;
+	GBytes *text;
+	GList *l;
+
+	g_mutex_lock(&cache_mutex);
+	if (!index_loaded || !index_dirty) {
+		g_mutex_unlock(&cache_mutex);
+		return;
+	}
+	index_dirty = FALSE;
+
+	index = json_object_new_object();
+	for (l = cache_lru.head; l; l = l->next) {
+		struct contacts_cache *c = l->data;
+
+		if (!c->disk_bytes)
+			continue;
+
+		jentry = json_object_new_object();
+		json_object_object_add(jentry, "disk_bytes",
+			json_object_new_int64(c->disk_bytes));
+		json_object_object_add(jentry, "last_used",
+			json_object_new_int64(c->last_used));
+		json_object_object_add(index, c->address, jentry);
+	}
+	g_mutex_unlock(&cache_mutex);
+
+	text = text_new(index);
+	cache_persist(INDEX_KEY, text);
+	g_bytes_unref(text);
+	json_object_put(index);
+}
+
+static gint compare_last_used(gconstpointer a, gconstpointer b)
+{
+	const struct contacts_cache *ca = *(struct contacts_cache **) a;
+	const struct contacts_cache *cb = *(struct contacts_cache **) b;
+
+	return (cb->last_used > ca->last_used) - (cb->last_used < ca->last_used);
+}
+
+/*
+ * Devices from the persisted index rank behind any used since start,
+ * most recently used first.
+ */
+static void index_read_cb(void *closure, struct json_object *result,
+			  const char *error, const char *info, afb_api_t api)
+{
+	struct json_object *index = NULL, *val = NULL;
+	GPtrArray *loaded = g_ptr_array_new();
+	GSList *deleted;
+	int i;
+
+	if (!error && json_object_object_get_ex(result, "value", &val))
+		index = cache_decode(json_object_get_string(val));
+
+	g_mutex_lock(&cache_mutex);
+	if (index && json_object_is_type(index, json_type_object)) {
+		json_object_object_foreach(index, address, jentry) {
+			struct contacts_cache *c = g_hash_table_lookup(caches, address);
+
+			if (!c) {
+				c = cache_new(address);
+				g_ptr_array_add(loaded, c);
+			}
+
+			if (!c->disk_bytes && json_object_object_get_ex(jentry, "disk_bytes", &val))
+				cache_set_disk_bytes(c, json_object_get_int64(val));
+			if (!c->last_used && json_object_object_get_ex(jentry, "last_used", &val))
+				c->last_used = json_object_get_int64(val);
+		}
+	}
+
+	g_ptr_array_sort(loaded, compare_last_used);
+	for (i = 0; i < loaded->len; i++) {
+		struct contacts_cache *c = g_ptr_array_index(loaded, i);
+
+		g_queue_push_tail_link(&cache_lru, &c->link);
+	}
+
+	index_loaded = TRUE;
+	deleted = cache_evict();
+	g_mutex_unlock(&cache_mutex);
+
+	AFB_INFO("Cache index loaded: %u devices, %" G_GSIZE_FORMAT " bytes persisted",
+		 loaded->len, disk_used);
+
+	g_ptr_array_free(loaded, TRUE);
+	json_object_put(index);
+
+	cache_delete(deleted);
+	index_sync();
+}
+
+/* contacts of a device encoded for persistence by a worker */
+struct cache_write {
+	gchar *address;
+	GBytes *text;
+	gchar *value;
+};
+
+static void cache_encode_work(gpointer data)
+{
+	struct cache_write *w = data;
+	gint64 start = g_get_monotonic_time();
+	const gchar *raw;
+	gsize len;
+
+	raw = g_bytes_get_data(w->text, &len);
+	w->value = pbap_codec_encode(config.codec, raw, len);
+	if (!w->value)
+		return;
+
+	g_mutex_lock(&metrics_mutex);
+	codec_metrics.encoded++;
+	codec_metrics.raw_bytes += len;
+	codec_metrics.encoded_bytes += strlen(w->value);
+	codec_metrics.encode_time += g_get_monotonic_time() - start;
+	g_mutex_unlock(&metrics_mutex);
+}
+
+static void cache_write_free(struct cache_write *w)
+{
+	g_free(w->address);
+	g_bytes_unref(w->text);
+	g_free(w->value);
+	g_free(w);
+}
+
+/* from the main loop, once encoded */
+static gboolean cache_write_done(gpointer data)
+{
+	struct cache_write *w = data;
+	struct contacts_cache *c = NULL;
+	GSList *deleted = NULL;
+
+	if (!w->value) {
+		AFB_ERROR("Failed to encode contacts of %s", w->address);
+		persist_forget(w->address);
+		persist_done(FALSE);
+		cache_write_free(w);
+		return G_SOURCE_REMOVE;
+	}
+
+	if (g_strcmp0(w->address, INDEX_KEY)) {
+		g_mutex_lock(&cache_mutex);
+		c = g_hash_table_lookup(caches, w->address);
+		if (c) {
+			cache_set_disk_bytes(c, strlen(w->value));
+			deleted = cache_evict();
+		}
+		g_mutex_unlock(&cache_mutex);
+
+		/* evicted while the write was pending */
+		if (!c) {
+			persist_done(FALSE);
+			cache_write_free(w);
+			return G_SOURCE_REMOVE;
+		}
+	}
+
+	pbap_persist_store(w->address, w->value, persist_store_cb, NULL);
+	cache_write_free(w);
+
+	cache_delete(deleted);
+	if (c)
+		index_sync();
+
+	return G_SOURCE_REMOVE;
+}
+
+/* compressing multi-MB contacts is left to a worker, only the write is not */
+static void cache_write(const gchar *address, GBytes *text)
+{
+	struct cache_write *w = g_new0(struct cache_write, 1);
+
+	w->address = g_strdup(address);
+	w->text = g_bytes_ref(text);
+
+	pbap_loop_work(cache_encode_work, cache_write_done, w);
+}
+
+static gboolean persist_flush(gpointer user_data);
+
+/* persist_mutex must be held */
+static void persist_schedule(void)
+{
+	if (persist_timer || persist_writes ||
+	    !g_hash_table_size(persist_pending))
+		return;
+
+	persist_timer = pbap_loop_timeout_add_seconds(config.write_delay,
+						      persist_flush, NULL);
+}
+
+static void persist_done(gboolean written)
+{
+	g_mutex_lock(&persist_mutex);
+	if (written)
+		persist_written++;
+	if (!--persist_writes)
+		persist_schedule();
+	g_mutex_unlock(&persist_mutex);
+}
+
+/* written data is unknown after a failure, so always write the next one */
+static void persist_forget(const gchar *address)
+{
+	g_mutex_lock(&persist_mutex);
+	g_hash_table_remove(persist_digests, address);
+	g_mutex_unlock(&persist_mutex);
+}
+
+static gboolean persist_flush(gpointer user_data)
+{
+	GHashTable *batch;
+	GHashTableIter iter;
+	gpointer key, value;
+
+	g_mutex_lock(&persist_mutex);
+	persist_timer = 0;
+	batch = persist_pending;
+	persist_pending = g_hash_table_new_full(g_str_hash, g_str_equal,
+						g_free, (GDestroyNotify) g_bytes_unref);
+	persist_writes += g_hash_table_size(batch);
+	g_mutex_unlock(&persist_mutex);
+
+	g_hash_table_iter_init(&iter, batch);
+	while (g_hash_table_iter_next(&iter, &key, &value))
+		cache_write(key, value);
+
+	g_hash_table_destroy(batch);
+
+	return G_SOURCE_REMOVE;
+}
+
+/*
+ * Queue contacts for the write-behind, off the caller's path. Data
+ * identical to what was last queued for the device is not written.
+ */
+static void cache_persist(const gchar *address, GBytes *text)
+{
+	gchar *digest = g_compute_checksum_for_bytes(G_CHECKSUM_SHA1, text);
+
+	g_mutex_lock(&persist_mutex);
+	if (!g_strcmp0(g_hash_table_lookup(persist_digests, address), digest)) {
+		persist_skipped++;
+		g_mutex_unlock(&persist_mutex);
+		g_free(digest);
+		return;
+	}
+	g_hash_table_replace(persist_digests, g_strdup(address), digest);
+
+	if (g_hash_table_contains(persist_pending, address))
+		persist_coalesced++;
+	g_hash_table_replace(persist_pending, g_strdup(address), g_bytes_ref(text));
+	persist_schedule();
+	g_mutex_unlock(&persist_mutex);
+}
+
+struct json_object *pbap_cache_lookup(const gchar *address, gboolean *stale)
+{
+	struct contacts_cache *c;
+	struct json_object *jresp = NULL, *decoded;
+	const char *cached = NULL;
+	GSList *deleted;
+	GBytes *vcards;
+
+	g_mutex_lock(&cache_mutex);
+	c = g_hash_table_lookup(caches, address);
+	if (c && c->vcards) {
+		jresp = cache_response(c);
+		*stale = cache_is_stale(c);
+		cache_touch(c);
+	}
+	g_mutex_unlock(&cache_mutex);
+
+	if (jresp) {
+		index_sync();
+		return jresp;
+	}
+
+	if (read_cached_value(address, &cached))
+		return NULL;
+
+	decoded = cache_decode(cached);
+	vcards = decoded ? vcards_new(decoded) : NULL;
+	json_object_put(decoded);
+	if (!vcards) {
+		g_free((gchar *) cached);
+		return NULL;
+	}
+
+	/* age of persisted data is unknown so it is always refreshed */
+	g_mutex_lock(&cache_mutex);
+	c = cache_get(address);
+	if (!c->vcards) {
+		cache_set_vcards(c, vcards);
+		c->timestamp = 0;
+	}
+	if (!c->disk_bytes)
+		cache_set_disk_bytes(c, strlen(cached));
+	jresp = cache_response(c);
+	*stale = cache_is_stale(c);
+	cache_touch(c);
+	deleted = cache_evict();
+	g_mutex_unlock(&cache_mutex);
+
+	g_bytes_unref(vcards);
+	g_free((gchar *) cached);
+	cache_delete(deleted);
+	index_sync();
+
+	return jresp;
+}
+
+gboolean pbap_cache_has(const gchar *address)
+{
+	struct contacts_cache *c;
+	gboolean ret;
+
+	g_mutex_lock(&cache_mutex);
+	c = g_hash_table_lookup(caches, address);
+	ret = c && (c->vcards || c->disk_bytes);
+	g_mutex_unlock(&cache_mutex);
+
+	return ret;
+}
+
+gboolean pbap_cache_begin_refresh(const gchar *address)
+{
+	struct contacts_cache *c;
+	gboolean ret;
+
+	g_mutex_lock(&cache_mutex);
+	c = cache_get(address);
+	ret = !c->refreshing;
+	c->refreshing = TRUE;
+	cache_touch(c);
+	g_mutex_unlock(&cache_mutex);
+
+	index_sync();
+
+	return ret;
+}
+
+gboolean pbap_cache_update(const gchar *address, gboolean refresh,
+			   struct json_object *result)
+{
+	struct contacts_cache *c;
+	GSList *deleted = NULL;
+	gboolean changed = FALSE;
+	GBytes *text = NULL, *vcards = NULL;
+	gchar *digest = NULL;
+
+	if (result && (vcards = vcards_new(result))) {
+		text = text_new(result);
+		digest = g_compute_checksum_for_bytes(G_CHECKSUM_SHA1, text);
+	}
+
+	g_mutex_lock(&cache_mutex);
+	c = cache_get(address);
+	if (refresh)
+		c->refreshing = FALSE;
+	if (text) {
+		/* the digest outlives contacts evicted from memory */
+		changed = g_strcmp0(c->digest, digest) != 0;
+		if (changed || !c->vcards)
+			cache_set_vcards(c, vcards);
+		g_free(c->digest);
+		c->digest = digest;
+		c->timestamp = g_get_monotonic_time();
+		cache_touch(c);
+		deleted = cache_evict();
+	}
+	g_mutex_unlock(&cache_mutex);
+
+	cache_delete(deleted);
+	if (changed)
+		cache_persist(address, text);
+	index_sync();
+
+	if (text) {
+		g_bytes_unref(text);
+		g_bytes_unref(vcards);
+	}
+
+	return changed;
+}
+
+void pbap_cache_metrics(struct json_object *response)
+{
+	struct json_object *jcache, *jpersist, *jdevices, *jdevice;
+	struct codec_metrics m;
+	GList *l;
+
+	g_mutex_lock(&metrics_mutex);
+	m = codec_metrics;
+	g_mutex_unlock(&metrics_mutex);
+
+	jpersist = json_object_new_object();
+	g_mutex_lock(&persist_mutex);
+	json_object_object_add(jpersist, "written",
+		json_object_new_int64(persist_written));
+	json_object_object_add(jpersist, "coalesced",
+		json_object_new_int64(persist_coalesced));
+	json_object_object_add(jpersist, "skipped",
+		json_object_new_int64(persist_skipped));
+	json_object_object_add(jpersist, "pending",
+		json_object_new_int(g_hash_table_size(persist_pending) + persist_writes));
+	g_mutex_unlock(&persist_mutex);
+
+	jcache = json_object_new_object();
+	json_object_object_add(jcache, "codec",
+		json_object_new_string(pbap_codec_to_string(config.codec)));
+	json_object_object_add(jcache, "encoded", json_object_new_int64(m.encoded));
+	json_object_object_add(jcache, "raw_bytes", json_object_new_int64(m.raw_bytes));
+	json_object_object_add(jcache, "encoded_bytes",
+		json_object_new_int64(m.encoded_bytes));
+	json_object_object_add(jcache, "ratio", json_object_new_double(
+		m.encoded_bytes ? (double) m.raw_bytes / m.encoded_bytes : 0.0));
+	json_object_object_add(jcache, "encode_time_us",
+		json_object_new_int64(m.encode_time));
+	json_object_object_add(jcache, "decoded", json_object_new_int64(m.decoded));
+	json_object_object_add(jcache, "decode_time_us",
+		json_object_new_int64(m.decode_time));
+
+	jdevices = json_object_new_array();
+	g_mutex_lock(&cache_mutex);
+	json_object_object_add(jcache, "memory_bytes", json_object_new_int64(memory_used));
+	json_object_object_add(jcache, "memory_budget",
+		json_object_new_int64(config.memory_budget));
+	json_object_object_add(jcache, "memory_evictions",
+		json_object_new_int64(memory_evictions));
+	json_object_object_add(jcache, "disk_bytes", json_object_new_int64(disk_used));
+	json_object_object_add(jcache, "disk_budget",
+		json_object_new_int64(config.disk_budget));
+	json_object_object_add(jcache, "disk_evictions",
+		json_object_new_int64(disk_evictions));
+
+	for (l = cache_lru.head; l; l = l->next) {
+		struct contacts_cache *c = l->data;
+
+		jdevice = json_object_new_object();
+		json_object_object_add(jdevice, "address",
+			json_object_new_string(c->address));
+		json_object_object_add(jdevice, "memory_bytes",
+			json_object_new_int64(cache_memory_bytes(c)));
+		json_object_object_add(jdevice, "disk_bytes",
+			json_object_new_int64(c->disk_bytes));
+		json_object_object_add(jdevice, "last_used",
+			json_object_new_int64(c->last_used));
+		json_object_array_add(jdevices, jdevice);
+	}
+	g_mutex_unlock(&cache_mutex);
+
+	json_object_object_add(response, "cache", jcache);
+	json_object_object_add(response, "persistence", jpersist);
+	json_object_object_add(response, "devices", jdevices);
+}
+
+void pbap_cache_init(const struct pbap_cache_config *cfg)
+{
+	struct json_object *query;
+
+	config = *cfg;
+
+	caches = g_hash_table_new_full(g_str_hash, g_str_equal, NULL, cache_free);
+	persist_pending = g_hash_table_new_full(g_str_hash, g_str_equal,
+						g_free, (GDestroyNotify) g_bytes_unref);
+	persist_digests = g_hash_table_new_full(g_str_hash, g_str_equal,
+						g_free, g_free);
+
+	query = json_object_new_object();
+	json_object_object_add(query, "key", json_object_new_string(INDEX_KEY));
+	afb_service_call("persistence", "read", query, index_read_cb, NULL);
+}
@@ -0,0 +1,60 @@
+/*
+ * Copyright (C) 2018 Konsulko Group
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef BLUETOOTH_PBAP_CACHE_H
+#define BLUETOOTH_PBAP_CACHE_H
+
+#include <glib.h>
+#include <json-c/json.h>
+
+#include "bluetooth-pbap-codec.h"
+
+struct pbap_cache_config {
+	gint64 max_age;		/* seconds before contacts are stale */
+	gint64 write_delay;	/* seconds persistence writes are held back */
+	gint64 memory_budget;	/* bytes of contacts kept in memory, 0 unlimited */
+	gint64 disk_budget;	/* bytes of contacts kept in persistence, 0 unlimited */
+	enum pbap_codec codec;
+};
+
+/*
+ * Contacts cache for any number of devices, written to the persistence
+ * binding through a write-behind. Devices least recently used are
+ * dropped from memory, then from persistence, to stay within budget.
+ * The device most recently used is never evicted.
+ */
+void pbap_cache_init(const struct pbap_cache_config *config);
+
+/* returns the cached contacts of a device as a new response, or NULL */
+struct json_object *pbap_cache_lookup(const gchar *address, gboolean *stale);
+
+/* returns TRUE if contacts of the device are cached in memory or persisted */
+gboolean pbap_cache_has(const gchar *address);
+
+/* returns FALSE if a background refresh of the device is already running */
+gboolean pbap_cache_begin_refresh(const gchar *address);
+
+/*
+ * Store freshly fetched contacts, or only end a background refresh if
+ * result is NULL. Returns TRUE if the contacts differ from the cached ones.
+ */
+gboolean pbap_cache_update(const gchar *address, gboolean refresh,
+			   struct json_object *result);
+
+/* adds the "cache", "persistence" and "devices" sections */
+void pbap_cache_metrics(struct json_object *response);
+
+#endif
@@ -0,0 +1,353 @@
+/*
+ * Copyright (C) 2018 Konsulko Group
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#define _GNU_SOURCE
+#include <gio/gio.h>
+#include <glib.h>
+#include <json-c/json.h>
+#include <string.h>
+
+#ifdef HAVE_ZSTD
+#include <zstd.h>
+#endif
+
+#define AFB_BINDING_VERSION 3
+#include <afb/afb-binding.h>
+
+#include "bluetooth-pbap-codec.h"
+
+#define CODEC_CHUNK	8192
+#define ZLIB_LEVEL	1
+#define ZSTD_LEVEL	3
+
+static const gchar *codec_names[] = {
+	[PBAP_CODEC_NONE] = "none",
+	[PBAP_CODEC_ZLIB] = "zlib",
+	[PBAP_CODEC_ZSTD] = "zstd",
+};
+
+typedef gboolean (*codec_sink)(const gchar *data, gsize len, gpointer user_data);
+
+struct base64_state {
+	GString *out;
+	gint state;
+	gint save;
+};
+
+struct json_state {
+	json_tokener *tok;
+	struct json_object *obj;
+};
+
+struct decoder {
+	enum pbap_codec codec;
+	GConverter *conv;
+#ifdef HAVE_ZSTD
+	ZSTD_DStream *zds;
+	size_t zret;
+#endif
+};
+
+gboolean pbap_codec_from_string(const gchar *name, enum pbap_codec *codec)
+{
+	int i;
+
+	for (i = 0; i < G_N_ELEMENTS(codec_names); i++) {
+		if (g_strcmp0(name, codec_names[i]))
+			continue;
+#ifndef HAVE_ZSTD
+		if (i == PBAP_CODEC_ZSTD)
+			return FALSE;
+#endif
+		*codec = i;
+		return TRUE;
+	}
+
+	return FALSE;
+}
+
+const gchar *pbap_codec_to_string(enum pbap_codec codec)
+{
+	return codec_names[codec];
+}
+
+static gboolean base64_sink(const gchar *data, gsize len, gpointer user_data)
+{
+	struct base64_state *b64 = user_data;
+	gsize pos = b64->out->len;
+
+	g_string_set_size(b64->out, pos + (len / 3 + 1) * 4 + 4);
+	pos += g_base64_encode_step((const guchar *) data, len, FALSE,
+			b64->out->str + pos, &b64->state, &b64->save);
+	g_string_set_size(b64->out, pos);
+
+	return TRUE;
+}
+
+static gboolean json_sink(const gchar *data, gsize len, gpointer user_data)
+{
+	struct json_state *js = user_data;
+	enum json_tokener_error err;
+
+	if (js->obj)
+		return TRUE;
+
+	js->obj = json_tokener_parse_ex(js->tok, data, len);
+	err = json_tokener_get_error(js->tok);
+	if (err != json_tokener_success && err != json_tokener_continue) {
+		AFB_ERROR("Invalid cached value: %s", json_tokener_error_desc(err));
+		return FALSE;
+	}
+
+	return TRUE;
+}
+
+/*
+ * Push input through a GConverter and hand every output chunk to the
+ * sink. Without at_end, returns once all input has been consumed.
+ */
+static gboolean converter_feed(GConverter *conv, const gchar *in, gsize in_len,
+			       gboolean at_end, codec_sink sink, gpointer user_data)
+{
+	gchar out[CODEC_CHUNK];
+	GConverterResult res;
+	GError *error = NULL;
+	gsize bytes_read, bytes_written;
+
+	for (;;) {
+		if (!in_len && !at_end)
+			return TRUE;
+
+		res = g_converter_convert(conv, in, in_len, out, sizeof(out),
+				at_end ? G_CONVERTER_INPUT_AT_END : G_CONVERTER_NO_FLAGS,
+				&bytes_read, &bytes_written, &error);
+		if (res == G_CONVERTER_ERROR) {
+			gboolean partial = g_error_matches(error, G_IO_ERROR,
+						G_IO_ERROR_PARTIAL_INPUT);
+
+			if (!partial || at_end)
+				AFB_ERROR("Codec failure: %s", error->message);
+			g_error_free(error);
+			return partial && !at_end;
+		}
+
+		in += bytes_read;
+		in_len -= bytes_read;
+
+		if (bytes_written && !sink(out, bytes_written, user_data))
+			return FALSE;
+
+		if (res == G_CONVERTER_FINISHED)
+			return TRUE;
+	}
+}
+
+static gboolean zlib_encode(const gchar *data, gsize len,
+			    codec_sink sink, gpointer user_data)
+{
+	GZlibCompressor *conv;
+	gboolean ret;
+
+	conv = g_zlib_compressor_new(G_ZLIB_COMPRESSOR_FORMAT_ZLIB, ZLIB_LEVEL);
+	ret = converter_feed(G_CONVERTER(conv), data, len, TRUE, sink, user_data);
+	g_object_unref(conv);
+
+	return ret;
+}
+
+#ifdef HAVE_ZSTD
+static gboolean zstd_encode(const gchar *data, gsize len,
+			    codec_sink sink, gpointer user_data)
+{
+	gsize bound = ZSTD_compressBound(len);
+	gchar *buf = g_malloc(bound);
+	gboolean ret = FALSE;
+	size_t n;
+
+	n = ZSTD_compress(buf, bound, data, len, ZSTD_LEVEL);
+	if (ZSTD_isError(n))
+		AFB_ERROR("Codec failure: %s", ZSTD_getErrorName(n));
+	else
+		ret = sink(buf, n, user_data);
+
+	g_free(buf);
+
+	return ret;
+}
+
+static gboolean zstd_feed(struct decoder *dec, const gchar *in, gsize in_len,
+			  gboolean at_end, codec_sink sink, gpointer user_data)
+{
+	gchar out[CODEC_CHUNK];
+	ZSTD_inBuffer input = { in, in_len, 0 };
+	ZSTD_outBuffer output;
+
+	do {
+		output.dst = out;
+		output.size = sizeof(out);
+		output.pos = 0;
+
+		dec->zret = ZSTD_decompressStream(dec->zds, &output, &input);
+		if (ZSTD_isError(dec->zret)) {
+			AFB_ERROR("Codec failure: %s", ZSTD_getErrorName(dec->zret));
+			return FALSE;
+		}
+
+		if (output.pos && !sink(out, output.pos, user_data))
+			return FALSE;
+	} while (input.pos < input.size || output.pos == output.size);
+
+	if (at_end && dec->zret) {
+		AFB_ERROR("Codec failure: truncated zstd frame");
+		return FALSE;
+	}
+
+	return TRUE;
+}
+#endif
+
+gchar *pbap_codec_encode(enum pbap_codec codec, const gchar *data, gsize len)
+{
+	struct base64_state b64 = { NULL, 0, 0 };
+	gboolean ret = FALSE;
+	gsize pos;
+
+	if (codec == PBAP_CODEC_NONE)
+		return g_strndup(data, len);
+
+	b64.out = g_string_new(pbap_codec_to_string(codec));
+	g_string_append_c(b64.out, ':');
+
+	switch (codec) {
+	case PBAP_CODEC_ZLIB:
+		ret = zlib_encode(data, len, base64_sink, &b64);
+		break;
+#ifdef HAVE_ZSTD
+	case PBAP_CODEC_ZSTD:
+		ret = zstd_encode(data, len, base64_sink, &b64);
+		break;
+#endif
+	default:
+		break;
+	}
+
+	if (!ret) {
+		g_string_free(b64.out, TRUE);
+		return NULL;
+	}
+
+	pos = b64.out->len;
+	g_string_set_size(b64.out, pos + 5);
+	pos += g_base64_encode_close(FALSE, b64.out->str + pos,
+				     &b64.state, &b64.save);
+	g_string_set_size(b64.out, pos);
+
+	return g_string_free(b64.out, FALSE);
+}
+
+static gboolean decoder_init(struct decoder *dec, const gchar *name, gsize len)
+{
+	gchar *codec_name = g_strndup(name, len);
+	gboolean ret;
+
+	ret = pbap_codec_from_string(codec_name, &dec->codec);
+	if (!ret)
+		AFB_ERROR("Unsupported cache codec '%s'", codec_name);
+	g_free(codec_name);
+
+	if (!ret)
+		return FALSE;
+
+	switch (dec->codec) {
+	case PBAP_CODEC_ZLIB:
+		dec->conv = G_CONVERTER(g_zlib_decompressor_new(
+				G_ZLIB_COMPRESSOR_FORMAT_ZLIB));
+		break;
+#ifdef HAVE_ZSTD
+	case PBAP_CODEC_ZSTD:
+		dec->zds = ZSTD_createDStream();
+		ZSTD_initDStream(dec->zds);
+		break;
+#endif
+	default:
+		return FALSE;
+	}
+
+	return TRUE;
+}
+
+static void decoder_free(struct decoder *dec)
+{
+	if (dec->conv)
+		g_object_unref(dec->conv);
+#ifdef HAVE_ZSTD
+	if (dec->zds)
+		ZSTD_freeDStream(dec->zds);
+#endif
+}
+
+static gboolean decoder_feed(struct decoder *dec, const gchar *in, gsize in_len,
+			     gboolean at_end, codec_sink sink, gpointer user_data)
+{
+#ifdef HAVE_ZSTD
+	if (dec->codec == PBAP_CODEC_ZSTD)
+		return zstd_feed(dec, in, in_len, at_end, sink, user_data);
+#endif
+	return converter_feed(dec->conv, in, in_len, at_end, sink, user_data);
+}
+
+struct json_object *pbap_codec_decode_json(const gchar *value)
+{
+	struct json_state js = { NULL, NULL };
+	struct decoder dec = { PBAP_CODEC_NONE };
+	guchar buf[CODEC_CHUNK / 4 * 3 + 3];
+	const gchar *payload;
+	gsize len, pos = 0, step, n;
+	gint state = 0;
+	guint save = 0;
+	gboolean ret = TRUE;
+
+	payload = strchr(value, ':');
+	if (value[0] == '{' || !payload)
+		return json_tokener_parse(value);
+
+	if (!decoder_init(&dec, value, payload - value)) {
+		decoder_free(&dec);
+		return NULL;
+	}
+
+	payload++;
+	len = strlen(payload);
+	js.tok = json_tokener_new();
+
+	while (ret && pos < len) {
+		step = MIN(len - pos, CODEC_CHUNK);
+		n = g_base64_decode_step(payload + pos, step, buf, &state, &save);
+		pos += step;
+		ret = decoder_feed(&dec, (const gchar *) buf, n, pos == len,
+				   json_sink, &js);
+	}
+
+	decoder_free(&dec);
+	json_tokener_free(js.tok);
+
+	if (!ret) {
+		json_object_put(js.obj);
+		return NULL;
+	}
+
+	return js.obj;
+}
@@ -0,0 +1,45 @@
+/*
+ * Copyright (C) 2018 Konsulko Group
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef BLUETOOTH_PBAP_CODEC_H
+#define BLUETOOTH_PBAP_CODEC_H
+
+#include <glib.h>
+#include <json-c/json.h>
+
+enum pbap_codec {
+	PBAP_CODEC_NONE,
+	PBAP_CODEC_ZLIB,
+	PBAP_CODEC_ZSTD,
+};
+
+gboolean pbap_codec_from_string(const gchar *name, enum pbap_codec *codec);
+const gchar *pbap_codec_to_string(enum pbap_codec codec);
+
+/*
+ * Encode a serialized JSON value for the persistence binding. The
+ * result is a printable string tagged with the codec that produced it.
+ */
+gchar *pbap_codec_encode(enum pbap_codec codec, const gchar *data, gsize len);
+
+/*
+ * Decode a value written by pbap_codec_encode(), or an untagged plain
+ * JSON value, feeding the decompressed stream straight to the JSON
+ * tokener. Returns NULL on corrupt data.
+ */
+struct json_object *pbap_codec_decode_json(const gchar *value);
+
+#endif
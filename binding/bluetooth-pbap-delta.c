@@ -0,0 +1,238 @@
+/*
+ * Copyright (C) 2018 Konsulko Group
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <glib.h>
+#include <json-c/json.h>
+#include <string.h>
+
+#include "bluetooth-pbap-delta.h"
+
+/* enough for the five lists of a few devices */
+#define MAX_SNAPSHOTS	32
+
+struct snapshot {
+	gchar *key;
+	/* handle -> vCard digest, or vCard digest -> vCard */
+	GHashTable *records;
+	GList link;
+};
+
+static GHashTable *snapshots;
+static GQueue snapshot_queue = G_QUEUE_INIT;
+static guint64 version;
+static GMutex delta_mutex;
+
+static void free_snapshot(gpointer data)
+{
+	struct snapshot *snap = data;
+
+	g_free(snap->key);
+	g_hash_table_destroy(snap->records);
+	g_free(snap);
+}
+
+static GHashTable *records_new(GPtrArray *cards, GPtrArray *handles)
+{
+	GHashTable *records;
+	guint i;
+
+	records = g_hash_table_new_full(g_str_hash, g_str_equal, g_free, g_free);
+
+	for (i = 0; i < cards->len; i++) {
+		const gchar *card = g_ptr_array_index(cards, i);
+		gchar *digest = g_compute_checksum_for_string(G_CHECKSUM_SHA1,
+							      card, -1);
+
+		if (handles)
+			g_hash_table_replace(records,
+				g_strdup(g_ptr_array_index(handles, i)), digest);
+		else
+			g_hash_table_replace(records, digest, g_strdup(card));
+	}
+
+	return records;
+}
+
+static void add_record(struct json_object *delta, const gchar *name,
+		       const gchar *record)
+{
+	struct json_object *array = NULL;
+
+	json_object_object_get_ex(delta, name, &array);
+	json_object_array_add(array, json_object_new_string(record));
+}
+
+/*
+ * Report records of a missing from b under name, and with modified
+ * those whose vCard digest differs.
+ */
+static gboolean diff_records(GHashTable *a, GHashTable *b, gboolean handles,
+			     gboolean modified, struct json_object *delta,
+			     const gchar *name)
+{
+	GHashTableIter iter;
+	gpointer key, value;
+	const gchar *other;
+	gboolean changed = FALSE;
+
+	g_hash_table_iter_init(&iter, a);
+	while (g_hash_table_iter_next(&iter, &key, &value)) {
+		other = g_hash_table_lookup(b, key);
+		if (!other) {
+			add_record(delta, name, handles ? key : value);
+			changed = TRUE;
+		} else if (modified && g_strcmp0(other, value)) {
+			add_record(delta, "modified", key);
+			changed = TRUE;
+		}
+	}
+
+	return changed;
+}
+
+struct json_object *pbap_delta_update(const gchar *key, GPtrArray *cards,
+				      GPtrArray *handles)
+{
+	struct json_object *delta;
+	struct snapshot *snap;
+	GHashTable *records;
+	gboolean changed = FALSE;
+
+	records = records_new(cards, handles);
+
+	delta = json_object_new_object();
+	json_object_object_add(delta, "added", json_object_new_array());
+	json_object_object_add(delta, "removed", json_object_new_array());
+	if (handles)
+		json_object_object_add(delta, "modified", json_object_new_array());
+
+	g_mutex_lock(&delta_mutex);
+	if (!snapshots)
+		snapshots = g_hash_table_new_full(g_str_hash, g_str_equal,
+						  NULL, free_snapshot);
+
+	/* the first list seen is only the baseline for the next one */
+	snap = g_hash_table_lookup(snapshots, key);
+	if (!snap) {
+		snap = g_new0(struct snapshot, 1);
+		snap->key = g_strdup(key);
+		snap->link.data = snap;
+		g_hash_table_insert(snapshots, snap->key, snap);
+	} else {
+		g_queue_unlink(&snapshot_queue, &snap->link);
+		changed = diff_records(records, snap->records, handles != NULL,
+				       handles != NULL, delta, "added");
+		changed |= diff_records(snap->records, records, handles != NULL,
+					FALSE, delta, "removed");
+		g_hash_table_destroy(snap->records);
+	}
+	g_queue_push_head_link(&snapshot_queue, &snap->link);
+
+	snap->records = records;
+
+	if (changed)
+		json_object_object_add(delta, "version",
+			json_object_new_int64(++version));
+
+	while (snapshot_queue.length > MAX_SNAPSHOTS) {
+		struct snapshot *old = snapshot_queue.tail->data;
+
+		g_queue_unlink(&snapshot_queue, &old->link);
+		g_hash_table_remove(snapshots, old->key);
+	}
+	g_mutex_unlock(&delta_mutex);
+
+	if (!changed) {
+		json_object_put(delta);
+		return NULL;
+	}
+
+	return delta;
+}
+
+static int array_find(struct json_object *array, const gchar *record)
+{
+	int i;
+
+	for (i = 0; i < json_object_array_length(array); i++) {
+		if (!g_strcmp0(record, json_object_get_string(
+				json_object_array_get_idx(array, i))))
+			return i;
+	}
+
+	return -1;
+}
+
+static gboolean array_remove(struct json_object *array, const gchar *record)
+{
+	int i = array ? array_find(array, record) : -1;
+
+	if (i < 0)
+		return FALSE;
+
+	json_object_array_del_idx(array, i, 1);
+
+	return TRUE;
+}
+
+static void array_add(struct json_object *array, const gchar *record)
+{
+	if (array && array_find(array, record) < 0)
+		json_object_array_add(array, json_object_new_string(record));
+}
+
+void pbap_delta_merge(struct json_object *pending, struct json_object *delta)
+{
+	struct json_object *added = NULL, *removed = NULL, *modified = NULL;
+	struct json_object *array = NULL, *val = NULL;
+	const gchar *record;
+	int i;
+
+	json_object_object_get_ex(pending, "added", &added);
+	json_object_object_get_ex(pending, "removed", &removed);
+	json_object_object_get_ex(pending, "modified", &modified);
+
+	json_object_object_get_ex(delta, "added", &array);
+	for (i = 0; array && i < json_object_array_length(array); i++) {
+		record = json_object_get_string(json_object_array_get_idx(array, i));
+		if (array_remove(removed, record))
+			array_add(modified, record);
+		else
+			array_add(added, record);
+	}
+
+	array = NULL;
+	json_object_object_get_ex(delta, "removed", &array);
+	for (i = 0; array && i < json_object_array_length(array); i++) {
+		record = json_object_get_string(json_object_array_get_idx(array, i));
+		if (!array_remove(added, record)) {
+			array_remove(modified, record);
+			array_add(removed, record);
+		}
+	}
+
+	array = NULL;
+	json_object_object_get_ex(delta, "modified", &array);
+	for (i = 0; array && i < json_object_array_length(array); i++) {
+		record = json_object_get_string(json_object_array_get_idx(array, i));
+		if (array_find(added, record) < 0)
+			array_add(modified, record);
+	}
+
+	if (json_object_object_get_ex(delta, "version", &val))
+		json_object_object_add(pending, "version", json_object_get(val));
+}
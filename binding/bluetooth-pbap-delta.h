@@ -0,0 +1,45 @@
+/*
+ * Copyright (C) 2018 Konsulko Group
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef BLUETOOTH_PBAP_DELTA_H
+#define BLUETOOTH_PBAP_DELTA_H
+
+#include <glib.h>
+#include <json-c/json.h>
+
+/*
+ * Compare a complete list of vCards with the one last seen for the
+ * same key, and remember it for the next comparison. With handles,
+ * records are identified by handle and the delta lists handles that
+ * were added, removed or modified. Without, records are identified
+ * by content and the delta lists added and removed vCards.
+ *
+ * Returns the delta with a "version" increasing on every change, or
+ * NULL if the list did not change or was not seen before. Snapshots
+ * of the least recently updated keys are dropped beyond a fixed count.
+ */
+struct json_object *pbap_delta_update(const gchar *key, GPtrArray *cards,
+				      GPtrArray *handles);
+
+/*
+ * Fold a later delta into a pending one, so that the result describes
+ * both changes: a record added then removed is dropped, one removed
+ * then added is reported as modified.
+ */
+void pbap_delta_merge(struct json_object *pending, struct json_object *delta);
+
+#endif
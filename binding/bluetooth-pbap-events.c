@@ -0,0 +1,296 @@
+/*
+ * Copyright (C) 2018 Konsulko Group
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <errno.h>
+#include <glib.h>
+#include <json-c/json.h>
+
+#include "bluetooth-pbap-events.h"
+#include "bluetooth-pbap-loop.h"
+
+struct event_channel {
+	struct pbap_event *parent;
+	afb_event_t event;
+	gchar *device;
+	gchar *list;
+	guint interval;
+	gint64 last_push;
+	GHashTable *pending;	/* held back payloads by device and list */
+	guint timer;
+};
+
+struct pbap_event {
+	gchar *name;
+	pbap_event_merge_fn merge;
+	GList *channels;
+};
+
+/* shared by all events, channels are flushed from the main loop */
+static GMutex events_mutex;
+
+struct pbap_event *pbap_event_new(const gchar *name, pbap_event_merge_fn merge)
+{
+	struct pbap_event *event = g_new0(struct pbap_event, 1);
+
+	event->name = g_strdup(name);
+	event->merge = merge;
+
+	return event;
+}
+
+static void channel_free(struct event_channel *ch)
+{
+	ch->parent->channels = g_list_remove(ch->parent->channels, ch);
+
+	if (ch->timer)
+		pbap_loop_source_remove(ch->timer);
+	if (ch->pending)
+		g_hash_table_unref(ch->pending);
+	afb_event_unref(ch->event);
+	g_free(ch->device);
+	g_free(ch->list);
+	g_free(ch);
+}
+
+static gboolean parse_filter(afb_req_t request, const gchar **list,
+			     guint *interval)
+{
+	const char *value;
+	gchar *end = NULL;
+	gint64 ms = 0;
+
+	*list = afb_req_value(request, "list");
+
+	value = afb_req_value(request, "interval");
+	if (value) {
+		ms = g_ascii_strtoll(value, &end, 10);
+		if (end == value || *end || ms < 0 || ms > G_MAXINT)
+			return FALSE;
+	}
+	*interval = ms;
+
+	return TRUE;
+}
+
+/* events_mutex must be held */
+static struct event_channel *find_channel(struct pbap_event *event,
+					  const gchar *device,
+					  const gchar *list, guint interval)
+{
+	GList *l;
+
+	for (l = event->channels; l; l = l->next) {
+		struct event_channel *ch = l->data;
+
+		if (!g_strcmp0(ch->device, device) && !g_strcmp0(ch->list, list) &&
+		    ch->interval == interval)
+			return ch;
+	}
+
+	return NULL;
+}
+
+int pbap_event_subscribe(struct pbap_event *event, afb_req_t request,
+			 const gchar *device)
+{
+	struct event_channel *ch;
+	const gchar *list;
+	guint interval;
+	int ret;
+
+	if (!parse_filter(request, &list, &interval))
+		return -EINVAL;
+
+	g_mutex_lock(&events_mutex);
+	ch = find_channel(event, device, list, interval);
+	if (!ch) {
+		ch = g_new0(struct event_channel, 1);
+		ch->parent = event;
+		ch->event = afb_daemon_make_event(event->name);
+		ch->device = g_strdup(device);
+		ch->list = g_strdup(list);
+		ch->interval = interval;
+		event->channels = g_list_prepend(event->channels, ch);
+	}
+
+	ret = afb_req_subscribe(request, ch->event);
+	g_mutex_unlock(&events_mutex);
+
+	return ret;
+}
+
+int pbap_event_unsubscribe(struct pbap_event *event, afb_req_t request,
+			   const gchar *device)
+{
+	struct event_channel *ch;
+	const gchar *list;
+	guint interval;
+	GList *l;
+
+	if (!parse_filter(request, &list, &interval))
+		return -EINVAL;
+
+	g_mutex_lock(&events_mutex);
+	if (device || list || interval) {
+		ch = find_channel(event, device, list, interval);
+		if (ch)
+			afb_req_unsubscribe(request, ch->event);
+	} else {
+		for (l = event->channels; l; l = l->next) {
+			ch = l->data;
+			afb_req_unsubscribe(request, ch->event);
+		}
+	}
+	g_mutex_unlock(&events_mutex);
+
+	return 0;
+}
+
+static gboolean channel_matches(struct event_channel *ch,
+				struct json_object *payload)
+{
+	struct json_object *val = NULL;
+
+	if (ch->device && json_object_object_get_ex(payload, "address", &val) &&
+	    g_ascii_strcasecmp(ch->device, json_object_get_string(val)))
+		return FALSE;
+
+	if (ch->list && json_object_object_get_ex(payload, "list", &val) &&
+	    g_strcmp0(ch->list, json_object_get_string(val)))
+		return FALSE;
+
+	return TRUE;
+}
+
+/*
+ * events_mutex must be held. Channels nobody listens to anymore are
+ * dropped, returns FALSE if ch was.
+ */
+static gboolean channel_push(struct event_channel *ch,
+			     struct json_object *payload)
+{
+	if (afb_event_push(ch->event, payload) <= 0) {
+		channel_free(ch);
+		return FALSE;
+	}
+
+	ch->last_push = g_get_monotonic_time();
+
+	return TRUE;
+}
+
+static gboolean channel_flush_cb(gpointer user_data)
+{
+	struct event_channel *ch = user_data;
+	struct json_object *payload;
+	GHashTable *pending;
+	GHashTableIter iter;
+	gchar *key;
+
+	g_mutex_lock(&events_mutex);
+	ch->timer = 0;
+	pending = ch->pending;
+	ch->pending = NULL;
+
+	g_hash_table_iter_init(&iter, pending);
+	while (g_hash_table_iter_next(&iter, (gpointer *) &key,
+				      (gpointer *) &payload)) {
+		g_hash_table_iter_steal(&iter);
+		g_free(key);
+		if (!channel_push(ch, payload))
+			break;
+	}
+	g_mutex_unlock(&events_mutex);
+
+	g_hash_table_unref(pending);
+
+	return G_SOURCE_REMOVE;
+}
+
+/*
+ * events_mutex must be held. Coalesces payload with the one held back
+ * for the same device and list, so that neither is reported as the
+ * other's. Takes ownership of payload.
+ */
+static void channel_hold(struct event_channel *ch, pbap_event_merge_fn merge,
+			 struct json_object *payload)
+{
+	struct json_object *address = NULL, *list = NULL, *pending;
+	gchar *key;
+
+	if (!ch->pending)
+		ch->pending = g_hash_table_new_full(g_str_hash, g_str_equal,
+				g_free, (GDestroyNotify) json_object_put);
+
+	json_object_object_get_ex(payload, "address", &address);
+	json_object_object_get_ex(payload, "list", &list);
+	key = g_strdup_printf("%s/%s", json_object_get_string(address),
+			      json_object_get_string(list));
+
+	pending = g_hash_table_lookup(ch->pending, key);
+	if (pending && merge) {
+		merge(pending, payload);
+		json_object_put(payload);
+		g_free(key);
+		return;
+	}
+
+	g_hash_table_replace(ch->pending, key, payload);
+}
+
+int pbap_event_push(struct pbap_event *event, struct json_object *payload)
+{
+	struct json_object *copy;
+	GList *l, *next;
+	gint64 wait;
+	int count;
+
+	g_mutex_lock(&events_mutex);
+	for (l = event->channels; l; l = next) {
+		struct event_channel *ch = l->data;
+
+		next = l->next;
+		if (!channel_matches(ch, payload))
+			continue;
+
+		/* payloads are not shared as json-c reference counts are not atomic */
+		copy = NULL;
+		if (json_object_deep_copy(payload, &copy, NULL))
+			continue;
+
+		if (ch->timer) {
+			channel_hold(ch, event->merge, copy);
+			continue;
+		}
+
+		wait = ch->last_push + ch->interval * 1000 - g_get_monotonic_time();
+		if (ch->interval && wait > 0) {
+			channel_hold(ch, event->merge, copy);
+			ch->timer = pbap_loop_timeout_add(wait / 1000 + 1,
+							  channel_flush_cb, ch);
+			continue;
+		}
+
+		channel_push(ch, copy);
+	}
+	count = g_list_length(event->channels);
+	g_mutex_unlock(&events_mutex);
+
+	json_object_put(payload);
+
+	return count;
+}
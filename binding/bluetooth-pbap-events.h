@@ -0,0 +1,58 @@
+/*
+ * Copyright (C) 2018 Konsulko Group
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef BLUETOOTH_PBAP_EVENTS_H
+#define BLUETOOTH_PBAP_EVENTS_H
+
+#include <glib.h>
+#include <json-c/json.h>
+
+#define AFB_BINDING_VERSION 3
+#include <afb/afb-binding.h>
+
+/*
+ * Event with per subscriber filters. Subscribers with the same filter
+ * share an afb event, which only receives payloads whose "address"
+ * and "list" match the filter, at most once per interval. Payloads
+ * held back by the interval are coalesced per address and list, by the
+ * merge function if set, otherwise by keeping only the latest.
+ */
+struct pbap_event;
+
+typedef void (*pbap_event_merge_fn)(struct json_object *pending,
+				    struct json_object *payload);
+
+struct pbap_event *pbap_event_new(const gchar *name, pbap_event_merge_fn merge);
+
+/*
+ * Subscribe or unsubscribe with the device address, NULL for any, and
+ * the "list" and "interval" (milliseconds) filters of the request.
+ * Unsubscribing without filter cancels all subscriptions to the event.
+ * Return 0 or -EINVAL.
+ */
+int pbap_event_subscribe(struct pbap_event *event, afb_req_t request,
+			 const gchar *device);
+int pbap_event_unsubscribe(struct pbap_event *event, afb_req_t request,
+			   const gchar *device);
+
+/*
+ * Takes ownership of payload, returns the number of channels still
+ * subscribed to, whether or not their filter matched it.
+ */
+int pbap_event_push(struct pbap_event *event, struct json_object *payload);
+
+#endif
@@ -0,0 +1,215 @@
+/*
+ * Copyright (C) 2018 Konsulko Group
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <glib.h>
+#include <json-c/json.h>
+
+#define AFB_BINDING_VERSION 3
+#include <afb/afb-binding.h>
+
+#include "bluetooth-pbap-link.h"
+#include "bluetooth-pbap-persist.h"
+
+#define LINK_KEY	"bluetooth-pbap-link"
+
+/* windows are kept within these bounds, MaxCount being 16 bit */
+#define WINDOW_MIN	50
+#define WINDOW_MAX	G_MAXUINT16
+
+/* weight of a new sample in the moving averages, in 1/WEIGHT */
+#define WEIGHT		4
+
+struct link {
+	gdouble overhead;	/* microseconds */
+	gdouble rate;		/* entries per second */
+	guint samples;
+};
+
+/* address -> struct link */
+static GHashTable *links;
+static GMutex links_mutex;
+static gboolean links_dirty;
+static guint default_window;
+static gint64 target_latency;
+
+static gdouble average(gdouble avg, gdouble sample, guint samples)
+{
+	return samples ? avg + (sample - avg) / WEIGHT : sample;
+}
+
+static void read_cb(void *closure, struct json_object *result,
+		    const char *error, const char *info, afb_api_t api)
+{
+	struct json_object *jlinks = NULL, *val = NULL;
+	guint loaded = 0;
+
+	if (!error && json_object_object_get_ex(result, "value", &val))
+		jlinks = json_tokener_parse(json_object_get_string(val));
+
+	g_mutex_lock(&links_mutex);
+	if (jlinks && json_object_is_type(jlinks, json_type_object)) {
+		json_object_object_foreach(jlinks, address, jlink) {
+			struct link *l;
+
+			/* measured since start, which is more recent */
+			if (g_hash_table_contains(links, address))
+				continue;
+
+			l = g_new0(struct link, 1);
+			if (json_object_object_get_ex(jlink, "overhead", &val))
+				l->overhead = json_object_get_double(val);
+			if (json_object_object_get_ex(jlink, "rate", &val))
+				l->rate = json_object_get_double(val);
+			if (json_object_object_get_ex(jlink, "samples", &val))
+				l->samples = json_object_get_int(val);
+
+			if (l->rate <= 0 || l->overhead < 0) {
+				g_free(l);
+				continue;
+			}
+
+			g_hash_table_insert(links, g_strdup(address), l);
+			loaded++;
+		}
+	}
+	g_mutex_unlock(&links_mutex);
+
+	AFB_INFO("Link estimates loaded for %u devices", loaded);
+	json_object_put(jlinks);
+}
+
+void pbap_link_init(guint window, gint64 latency)
+{
+	struct json_object *query;
+
+	default_window = CLAMP(window, 1, WINDOW_MAX);
+	target_latency = latency * 1000;
+	links = g_hash_table_new_full(g_str_hash, g_str_equal, g_free, g_free);
+
+	query = json_object_new_object();
+	json_object_object_add(query, "key", json_object_new_string(LINK_KEY));
+	afb_service_call("persistence", "read", query, read_cb, NULL);
+}
+
+/*
+ * Entries fitting in the target latency after the fixed cost of the
+ * request. Where that cost alone exceeds the target, windows take
+ * twice as long so it is no more than half of each.
+ */
+static guint link_window(struct link *l)
+{
+	gdouble budget, window;
+
+	if (!target_latency || !l || !l->samples)
+		return default_window;
+
+	budget = MAX(target_latency - l->overhead, l->overhead);
+	window = l->rate * budget / G_USEC_PER_SEC;
+
+	return CLAMP(window, WINDOW_MIN, WINDOW_MAX);
+}
+
+guint pbap_link_window(const gchar *address)
+{
+	guint window;
+
+	g_mutex_lock(&links_mutex);
+	window = link_window(g_hash_table_lookup(links, address));
+	g_mutex_unlock(&links_mutex);
+
+	return window;
+}
+
+void pbap_link_sample(const gchar *address, gint64 overhead,
+		      gint64 transfer, guint entries)
+{
+	struct link *l;
+
+	/* too short to tell the rate */
+	if (transfer <= 0 || !entries)
+		return;
+
+	g_mutex_lock(&links_mutex);
+	l = g_hash_table_lookup(links, address);
+	if (!l) {
+		l = g_new0(struct link, 1);
+		g_hash_table_insert(links, g_strdup(address), l);
+	}
+
+	l->overhead = average(l->overhead, MAX(overhead, 0), l->samples);
+	l->rate = average(l->rate, (gdouble) entries * G_USEC_PER_SEC / transfer,
+			  l->samples);
+	l->samples++;
+	links_dirty = TRUE;
+	g_mutex_unlock(&links_mutex);
+}
+
+static struct json_object *link_json(struct link *l)
+{
+	struct json_object *jlink = json_object_new_object();
+
+	json_object_object_add(jlink, "overhead", json_object_new_double(l->overhead));
+	json_object_object_add(jlink, "rate", json_object_new_double(l->rate));
+	json_object_object_add(jlink, "samples", json_object_new_int(l->samples));
+
+	return jlink;
+}
+
+void pbap_link_save(void)
+{
+	struct json_object *jlinks;
+	GHashTableIter iter;
+	const gchar *address;
+	struct link *l;
+
+	g_mutex_lock(&links_mutex);
+	if (!links_dirty) {
+		g_mutex_unlock(&links_mutex);
+		return;
+	}
+	links_dirty = FALSE;
+
+	jlinks = json_object_new_object();
+	g_hash_table_iter_init(&iter, links);
+	while (g_hash_table_iter_next(&iter, (gpointer *) &address, (gpointer *) &l))
+		json_object_object_add(jlinks, address, link_json(l));
+	g_mutex_unlock(&links_mutex);
+
+	pbap_persist_store(LINK_KEY, json_object_to_json_string_ext(jlinks,
+			   JSON_C_TO_STRING_PLAIN), NULL, NULL);
+	json_object_put(jlinks);
+}
+
+void pbap_link_metrics(struct json_object *response)
+{
+	struct json_object *jlinks = json_object_new_array(), *jlink;
+	GHashTableIter iter;
+	const gchar *address;
+	struct link *l;
+
+	g_mutex_lock(&links_mutex);
+	g_hash_table_iter_init(&iter, links);
+	while (g_hash_table_iter_next(&iter, (gpointer *) &address, (gpointer *) &l)) {
+		jlink = link_json(l);
+		json_object_object_add(jlink, "address", json_object_new_string(address));
+		json_object_object_add(jlink, "window", json_object_new_int(
+			link_window(l)));
+		json_object_array_add(jlinks, jlink);
+	}
+	g_mutex_unlock(&links_mutex);
+
+	json_object_object_add(response, "links", jlinks);
+}
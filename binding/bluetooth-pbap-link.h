@@ -0,0 +1,48 @@
+/*
+ * Copyright (C) 2018 Konsulko Group
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef BLUETOOTH_PBAP_LINK_H
+#define BLUETOOTH_PBAP_LINK_H
+
+#include <glib.h>
+#include <json-c/json.h>
+
+/*
+ * Transfer speed learned per device from the windows of chunked
+ * PullAll requests: the fixed cost of a request and the rate at which
+ * entries arrive. Windows are sized so each takes about latency
+ * milliseconds. Estimates are kept in the persistence binding for
+ * the next connection. Thread safe.
+ */
+void pbap_link_init(guint window, gint64 latency);
+
+/* entries to request in the next window of the device */
+guint pbap_link_window(const gchar *address);
+
+/*
+ * Account a window of entries, overhead being the microseconds until
+ * its transfer became active and transfer those it was active for.
+ */
+void pbap_link_sample(const gchar *address, gint64 overhead,
+		      gint64 transfer, guint entries);
+
+/* write estimates changed since the last call to persistence */
+void pbap_link_save(void);
+
+/* adds the "links" section */
+void pbap_link_metrics(struct json_object *response);
+
+#endif
@@ -0,0 +1,195 @@
+/*
+ * Copyright (C) 2018 Konsulko Group
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <glib.h>
+
+#define AFB_BINDING_VERSION 3
+#include <afb/afb-binding.h>
+
+#include "bluetooth-pbap-loop.h"
+
+static GMainContext *context;
+static GThreadPool *workers;
+
+/*
+ * Messages to the main loop, pushed with a compare and swap and
+ * taken all at once. The newest message is first.
+ */
+struct message {
+	GSourceFunc func;
+	gpointer data;
+	struct message *next;
+};
+
+static struct message *mailbox;
+
+struct work {
+	pbap_work_fn func;
+	GSourceFunc done;
+	gpointer data;
+};
+
+void pbap_loop_post(GSourceFunc func, gpointer data)
+{
+	struct message *msg = g_new(struct message, 1), *head;
+
+	msg->func = func;
+	msg->data = data;
+	do {
+		head = g_atomic_pointer_get(&mailbox);
+		msg->next = head;
+	} while (!g_atomic_pointer_compare_and_exchange(&mailbox, head, msg));
+
+	/* the main loop checks the mailbox before it sleeps again */
+	if (!head)
+		g_main_context_wakeup(context);
+}
+
+static gboolean mailbox_prepare(GSource *source, gint *timeout)
+{
+	*timeout = -1;
+
+	return g_atomic_pointer_get(&mailbox) != NULL;
+}
+
+static gboolean mailbox_check(GSource *source)
+{
+	return g_atomic_pointer_get(&mailbox) != NULL;
+}
+
+static gboolean mailbox_dispatch(GSource *source, GSourceFunc callback,
+				 gpointer user_data)
+{
+	struct message *msgs, *msg, *fifo = NULL;
+
+	do {
+		msgs = g_atomic_pointer_get(&mailbox);
+	} while (!g_atomic_pointer_compare_and_exchange(&mailbox, msgs, NULL));
+
+	while ((msg = msgs)) {
+		msgs = msg->next;
+		msg->next = fifo;
+		fifo = msg;
+	}
+
+	while ((msg = fifo)) {
+		fifo = msg->next;
+		msg->func(msg->data);
+		g_free(msg);
+	}
+
+	return G_SOURCE_CONTINUE;
+}
+
+static GSourceFuncs mailbox_funcs = {
+	.prepare = mailbox_prepare,
+	.check = mailbox_check,
+	.dispatch = mailbox_dispatch,
+};
+
+static guint source_attach(GSource *source, GSourceFunc func, gpointer data)
+{
+	guint id;
+
+	g_source_set_callback(source, func, data, NULL);
+	id = g_source_attach(source, context);
+	g_source_unref(source);
+
+	return id;
+}
+
+guint pbap_loop_timeout_add(guint interval, GSourceFunc func, gpointer data)
+{
+	return source_attach(g_timeout_source_new(interval), func, data);
+}
+
+guint pbap_loop_timeout_add_seconds(guint interval, GSourceFunc func,
+				    gpointer data)
+{
+	return source_attach(g_timeout_source_new_seconds(interval), func, data);
+}
+
+void pbap_loop_source_remove(guint id)
+{
+	GSource *source = g_main_context_find_source_by_id(context, id);
+
+	if (source)
+		g_source_destroy(source);
+}
+
+static void work_run(gpointer data, gpointer user_data)
+{
+	struct work *w = data;
+
+	w->func(w->data);
+	if (w->done)
+		pbap_loop_post(w->done, w->data);
+	g_free(w);
+}
+
+void pbap_loop_work(pbap_work_fn func, GSourceFunc done, gpointer data)
+{
+	struct work *w = g_new(struct work, 1);
+	GError *error = NULL;
+
+	w->func = func;
+	w->done = done;
+	w->data = data;
+
+	if (workers && g_thread_pool_push(workers, w, &error))
+		return;
+
+	/* done still runs from the main loop, as with a worker */
+	if (error) {
+		AFB_WARNING("Failed to hand work to a worker: %s", error->message);
+		g_error_free(error);
+	}
+	work_run(w, NULL);
+}
+
+static gpointer loop_thread(gpointer data)
+{
+	GMainLoop *loop = g_main_loop_new(context, FALSE);
+
+	/* D-Bus replies and signals subscribed from here go to the context */
+	g_main_context_push_thread_default(context);
+	g_main_loop_run(loop);
+
+	return NULL;
+}
+
+void pbap_loop_init(guint workers_max)
+{
+	GSource *source;
+	GError *error = NULL;
+
+	context = g_main_context_new();
+
+	source = g_source_new(&mailbox_funcs, sizeof(GSource));
+	g_source_attach(source, context);
+	g_source_unref(source);
+
+	if (workers_max) {
+		workers = g_thread_pool_new(work_run, NULL, workers_max, FALSE, &error);
+		if (!workers) {
+			AFB_WARNING("No worker threads, work runs inline: %s",
+				    error->message);
+			g_error_free(error);
+		}
+	}
+
+	g_thread_unref(g_thread_new("pbap-loop", loop_thread, NULL));
+}
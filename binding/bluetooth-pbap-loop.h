@@ -0,0 +1,51 @@
+/*
+ * Copyright (C) 2018 Konsulko Group
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef BLUETOOTH_PBAP_LOOP_H
+#define BLUETOOTH_PBAP_LOOP_H
+
+#include <glib.h>
+
+/*
+ * Main loop of the binding, run by a thread of its own on a private
+ * GMainContext, so that D-Bus I/O is not held up by anything else in
+ * the process using the global default context. CPU heavy work such
+ * as reading, indexing and serializing vCards goes to a pool of
+ * worker threads instead of holding up transfer signals.
+ */
+void pbap_loop_init(guint workers);
+
+/*
+ * May be called from any thread without locking, func runs once from
+ * the main loop, in the order posted.
+ */
+void pbap_loop_post(GSourceFunc func, gpointer data);
+
+/* g_timeout_add() and friends for the main loop of the binding */
+guint pbap_loop_timeout_add(guint interval, GSourceFunc func, gpointer data);
+guint pbap_loop_timeout_add_seconds(guint interval, GSourceFunc func,
+				    gpointer data);
+void pbap_loop_source_remove(guint id);
+
+/*
+ * Run work from a worker thread, then done, if any, from the main
+ * loop. Work of several calls may run in parallel and in any order.
+ */
+typedef void (*pbap_work_fn)(gpointer data);
+
+void pbap_loop_work(pbap_work_fn work, GSourceFunc done, gpointer data);
+
+#endif
@@ -0,0 +1,205 @@
+/*
+ * Copyright (C) 2018 Konsulko Group
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <glib.h>
+#include <json-c/json.h>
+#include <string.h>
+
+#include "bluetooth-pbap-lru.h"
+
+struct lru_node {
+	gchar *key;
+	gchar *value;
+	gsize size;
+	GList link;
+};
+
+struct pbap_lru {
+	GHashTable *table;
+	GQueue queue;
+	guint max_entries;
+	gsize max_bytes;
+	gsize bytes;
+	guint64 hits;
+	guint64 misses;
+	guint64 evictions;
+	GMutex mutex;
+};
+
+static void free_node(gpointer data)
+{
+	struct lru_node *node = data;
+
+	g_free(node->key);
+	g_free(node->value);
+	g_free(node);
+}
+
+struct pbap_lru *pbap_lru_new(guint max_entries, gsize max_bytes)
+{
+	struct pbap_lru *lru = g_new0(struct pbap_lru, 1);
+
+	lru->table = g_hash_table_new_full(g_str_hash, g_str_equal, NULL, free_node);
+	g_queue_init(&lru->queue);
+	g_mutex_init(&lru->mutex);
+	lru->max_entries = max_entries;
+	lru->max_bytes = max_bytes;
+
+	return lru;
+}
+
+void pbap_lru_free(struct pbap_lru *lru)
+{
+	g_hash_table_destroy(lru->table);
+	g_mutex_clear(&lru->mutex);
+	g_free(lru);
+}
+
+/* lru->mutex must be held */
+static void remove_node(struct pbap_lru *lru, struct lru_node *node)
+{
+	g_queue_unlink(&lru->queue, &node->link);
+	lru->bytes -= node->size;
+	g_hash_table_remove(lru->table, node->key);
+}
+
+gchar *pbap_lru_lookup(struct pbap_lru *lru, const gchar *key)
+{
+	struct lru_node *node;
+	gchar *value = NULL;
+
+	g_mutex_lock(&lru->mutex);
+	node = g_hash_table_lookup(lru->table, key);
+	if (node) {
+		g_queue_unlink(&lru->queue, &node->link);
+		g_queue_push_head_link(&lru->queue, &node->link);
+		value = g_strdup(node->value);
+		lru->hits++;
+	} else {
+		lru->misses++;
+	}
+	g_mutex_unlock(&lru->mutex);
+
+	return value;
+}
+
+/* lru->mutex must be held */
+static struct lru_node *add_node(struct pbap_lru *lru, const gchar *key,
+				 const gchar *value)
+{
+	struct lru_node *node;
+
+	node = g_hash_table_lookup(lru->table, key);
+	if (node)
+		remove_node(lru, node);
+
+	node = g_new0(struct lru_node, 1);
+	node->key = g_strdup(key);
+	node->value = g_strdup(value);
+	node->size = strlen(value);
+	node->link.data = node;
+
+	g_hash_table_insert(lru->table, node->key, node);
+	lru->bytes += node->size;
+
+	return node;
+}
+
+/* lru->mutex must be held */
+static void evict(struct pbap_lru *lru)
+{
+	while (lru->queue.length > 1 &&
+	       ((lru->max_entries && lru->queue.length > lru->max_entries) ||
+		(lru->max_bytes && lru->bytes > lru->max_bytes))) {
+		remove_node(lru, lru->queue.tail->data);
+		lru->evictions++;
+	}
+}
+
+void pbap_lru_insert(struct pbap_lru *lru, const gchar *key, const gchar *value)
+{
+	struct lru_node *node;
+
+	g_mutex_lock(&lru->mutex);
+	node = add_node(lru, key, value);
+	g_queue_push_head_link(&lru->queue, &node->link);
+	evict(lru);
+	g_mutex_unlock(&lru->mutex);
+}
+
+gboolean pbap_lru_prefill(struct pbap_lru *lru, const gchar *key, const gchar *value)
+{
+	struct lru_node *node;
+	gsize size = strlen(value);
+
+	g_mutex_lock(&lru->mutex);
+	node = g_hash_table_lookup(lru->table, key);
+	if (node) {
+		/* refreshed where it is, as recently used as before */
+		lru->bytes = lru->bytes - node->size + size;
+		g_free(node->value);
+		node->value = g_strdup(value);
+		node->size = size;
+		evict(lru);
+		g_mutex_unlock(&lru->mutex);
+		return TRUE;
+	}
+
+	if ((lru->max_entries && lru->queue.length >= lru->max_entries) ||
+	    (lru->max_bytes && lru->bytes + size > lru->max_bytes)) {
+		g_mutex_unlock(&lru->mutex);
+		return FALSE;
+	}
+
+	node = add_node(lru, key, value);
+	g_queue_push_tail_link(&lru->queue, &node->link);
+	g_mutex_unlock(&lru->mutex);
+
+	return TRUE;
+}
+
+void pbap_lru_remove_prefix(struct pbap_lru *lru, const gchar *prefix)
+{
+	GList *l, *next;
+
+	g_mutex_lock(&lru->mutex);
+	for (l = lru->queue.head; l; l = next) {
+		struct lru_node *node = l->data;
+
+		next = l->next;
+		if (g_str_has_prefix(node->key, prefix))
+			remove_node(lru, node);
+	}
+	g_mutex_unlock(&lru->mutex);
+}
+
+struct json_object *pbap_lru_stats(struct pbap_lru *lru)
+{
+	struct json_object *jstats = json_object_new_object();
+
+	g_mutex_lock(&lru->mutex);
+	json_object_object_add(jstats, "entries",
+		json_object_new_int(lru->queue.length));
+	json_object_object_add(jstats, "bytes", json_object_new_int64(lru->bytes));
+	json_object_object_add(jstats, "hits", json_object_new_int64(lru->hits));
+	json_object_object_add(jstats, "misses", json_object_new_int64(lru->misses));
+	json_object_object_add(jstats, "evictions",
+		json_object_new_int64(lru->evictions));
+	g_mutex_unlock(&lru->mutex);
+
+	return jstats;
+}
@@ -0,0 +1,48 @@
+/*
+ * Copyright (C) 2018 Konsulko Group
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef BLUETOOTH_PBAP_LRU_H
+#define BLUETOOTH_PBAP_LRU_H
+
+#include <glib.h>
+#include <json-c/json.h>
+
+/*
+ * Thread safe string cache bounded by entry count and total value
+ * size, evicting the least recently used entries. A bound of 0 means
+ * unlimited.
+ */
+struct pbap_lru;
+
+struct pbap_lru *pbap_lru_new(guint max_entries, gsize max_bytes);
+void pbap_lru_free(struct pbap_lru *lru);
+
+/* returns a copy of the value, to be freed with g_free() */
+gchar *pbap_lru_lookup(struct pbap_lru *lru, const gchar *key);
+void pbap_lru_insert(struct pbap_lru *lru, const gchar *key, const gchar *value);
+
+/*
+ * Refresh the value of an entry, keeping its place, or else add it as
+ * least recently used, only if it fits without evicting anything.
+ * Used to pre-populate the cache.
+ */
+gboolean pbap_lru_prefill(struct pbap_lru *lru, const gchar *key, const gchar *value);
+void pbap_lru_remove_prefix(struct pbap_lru *lru, const gchar *prefix);
+
+struct json_object *pbap_lru_stats(struct pbap_lru *lru);
+
+#endif
@@ -0,0 +1,184 @@
+/*
+ * Copyright (C) 2018 Konsulko Group
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <glib.h>
+#include <json-c/json.h>
+#include <string.h>
+
+#include "bluetooth-pbap-numbers.h"
+#include "bluetooth-pbap-vcard.h"
+
+/* trailing digits compared, long enough to tell subscribers apart */
+#define MATCH_DIGITS	9
+
+struct number_entry {
+	gchar *name;
+	gchar *handle;
+	gboolean photo;
+};
+
+/* address -> (digits -> struct number_entry) */
+static GHashTable *indexes;
+static GMutex numbers_mutex;
+
+static void free_entry(gpointer data)
+{
+	struct number_entry *entry = data;
+
+	g_free(entry->name);
+	g_free(entry->handle);
+	g_free(entry);
+}
+
+/* returns the trailing digits of a number, or NULL if it has none */
+static gchar *number_key(const gchar *number)
+{
+	GString *digits = g_string_new(NULL);
+	const gchar *p;
+
+	for (p = number; *p; p++) {
+		if (g_ascii_isdigit(*p))
+			g_string_append_c(digits, *p);
+	}
+
+	if (!digits->len) {
+		g_string_free(digits, TRUE);
+		return NULL;
+	}
+
+	if (digits->len > MATCH_DIGITS)
+		g_string_erase(digits, 0, digits->len - MATCH_DIGITS);
+
+	return g_string_free(digits, FALSE);
+}
+
+static GHashTable *index_new(GPtrArray *cards, GPtrArray *handles)
+{
+	GHashTable *index;
+	guint i, j;
+
+	index = g_hash_table_new_full(g_str_hash, g_str_equal, g_free, free_entry);
+
+	for (i = 0; i < cards->len; i++) {
+		const gchar *card = g_ptr_array_index(cards, i);
+		GPtrArray *numbers = pbap_vcard_get_values(card, "TEL");
+		GPtrArray *names;
+		gboolean photo;
+
+		if (!numbers->len) {
+			g_ptr_array_unref(numbers);
+			continue;
+		}
+
+		names = pbap_vcard_get_values(card, "FN");
+		photo = pbap_vcard_has_property(card, "PHOTO");
+
+		for (j = 0; j < numbers->len; j++) {
+			gchar *key = number_key(g_ptr_array_index(numbers, j));
+			struct number_entry *entry;
+
+			/* the first contact with a number wins */
+			if (!key || g_hash_table_contains(index, key)) {
+				g_free(key);
+				continue;
+			}
+
+			entry = g_new0(struct number_entry, 1);
+			entry->name = g_strdup(names->len ?
+					g_ptr_array_index(names, 0) : NULL);
+			entry->handle = handles ?
+				g_strdup(g_ptr_array_index(handles, i)) : NULL;
+			entry->photo = photo;
+			g_hash_table_insert(index, key, entry);
+		}
+
+		g_ptr_array_unref(names);
+		g_ptr_array_unref(numbers);
+	}
+
+	return index;
+}
+
+static void index_store(const gchar *address, GHashTable *index,
+			gboolean replace)
+{
+	g_mutex_lock(&numbers_mutex);
+	if (!indexes)
+		indexes = g_hash_table_new_full(g_str_hash, g_str_equal, g_free,
+				(GDestroyNotify) g_hash_table_destroy);
+	if (replace || !g_hash_table_contains(indexes, address)) {
+		g_hash_table_replace(indexes, g_strdup(address), index);
+		index = NULL;
+	}
+	g_mutex_unlock(&numbers_mutex);
+
+	if (index)
+		g_hash_table_destroy(index);
+}
+
+void pbap_numbers_update(const gchar *address, GPtrArray *cards,
+			 GPtrArray *handles)
+{
+	index_store(address, index_new(cards, handles), TRUE);
+}
+
+void pbap_numbers_seed(const gchar *address, GPtrArray *cards)
+{
+	index_store(address, index_new(cards, NULL), FALSE);
+}
+
+void pbap_numbers_remove(const gchar *address)
+{
+	g_mutex_lock(&numbers_mutex);
+	if (indexes)
+		g_hash_table_remove(indexes, address);
+	g_mutex_unlock(&numbers_mutex);
+}
+
+struct json_object *pbap_numbers_lookup(const gchar *address,
+					const gchar *number)
+{
+	struct json_object *jresp = NULL;
+	struct number_entry *entry = NULL;
+	GHashTable *index = NULL;
+	gchar *key = number_key(number);
+
+	if (!key)
+		return NULL;
+
+	g_mutex_lock(&numbers_mutex);
+	if (indexes && address)
+		index = g_hash_table_lookup(indexes, address);
+	if (index)
+		entry = g_hash_table_lookup(index, key);
+	if (entry) {
+		jresp = json_object_new_object();
+		if (entry->name)
+			json_object_object_add(jresp, "name",
+				json_object_new_string(entry->name));
+		if (entry->handle)
+			json_object_object_add(jresp, "handle",
+				json_object_new_string(entry->handle));
+		json_object_object_add(jresp, "photo",
+			json_object_new_boolean(entry->photo));
+	}
+	g_mutex_unlock(&numbers_mutex);
+
+	g_free(key);
+
+	return jresp;
+}
@@ -0,0 +1,45 @@
+/*
+ * Copyright (C) 2018 Konsulko Group
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef BLUETOOTH_PBAP_NUMBERS_H
+#define BLUETOOTH_PBAP_NUMBERS_H
+
+#include <glib.h>
+#include <json-c/json.h>
+
+/*
+ * Index of the phone numbers found in the contacts of each device,
+ * matched on their trailing digits so that national and international
+ * forms of a number resolve to the same contact. Handles may be NULL
+ * when the vCards cannot be mapped to them.
+ */
+void pbap_numbers_update(const gchar *address, GPtrArray *cards,
+			 GPtrArray *handles);
+void pbap_numbers_remove(const gchar *address);
+
+/* index contacts known from before, unless the device has an index already */
+void pbap_numbers_seed(const gchar *address, GPtrArray *cards);
+
+/*
+ * Returns the "name" and "handle", if known, of the contact with the
+ * number, and whether its vCard has a "photo", or NULL if the number
+ * is unknown.
+ */
+struct json_object *pbap_numbers_lookup(const gchar *address,
+					const gchar *number);
+
+#endif
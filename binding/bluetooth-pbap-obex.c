@@ -0,0 +1,307 @@
+/*
+ * Copyright (C) 2018 Konsulko Group
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <gio/gio.h>
+#include <glib.h>
+
+#define AFB_BINDING_VERSION 3
+#include <afb/afb-binding.h>
+
+#include "bluetooth-pbap-obex.h"
+
+#define OBEX_SERVICE		"org.bluez.obex"
+#define OBEX_PATH		"/org/bluez/obex"
+#define CLIENT_INTERFACE	"org.bluez.obex.Client1"
+#define SESSION_INTERFACE	"org.bluez.obex.Session1"
+#define PHONEBOOK_INTERFACE	"org.bluez.obex.PhonebookAccess1"
+#define TRANSFER_INTERFACE	"org.bluez.obex.Transfer1"
+#define PROPERTIES_INTERFACE	"org.freedesktop.DBus.Properties"
+
+static GDBusConnection *conn;
+
+struct watch {
+	pbap_obex_changed_fn changed;
+	gpointer user_data;
+};
+
+static void call(const gchar *path, const gchar *interface,
+		 const gchar *method, GVariant *parameters,
+		 const gchar *reply_type, GCancellable *cancel,
+		 GAsyncReadyCallback callback, gpointer user_data)
+{
+	g_dbus_connection_call(conn, OBEX_SERVICE, path, interface, method,
+			parameters,
+			reply_type ? G_VARIANT_TYPE(reply_type) : NULL,
+			G_DBUS_CALL_FLAGS_NONE, -1, cancel,
+			callback, user_data);
+}
+
+static GVariant *call_finish(GAsyncResult *res, GError **error)
+{
+	return g_dbus_connection_call_finish(conn, res, error);
+}
+
+static void properties_changed_cb(GDBusConnection *connection,
+				  const gchar *sender, const gchar *path,
+				  const gchar *interface, const gchar *signal,
+				  GVariant *parameters, gpointer user_data)
+{
+	struct watch *w = user_data;
+	GVariant *changed;
+
+	if (!g_variant_is_of_type(parameters, G_VARIANT_TYPE("(sa{sv}as)")))
+		return;
+
+	changed = g_variant_get_child_value(parameters, 1);
+	w->changed(path, changed, w->user_data);
+	g_variant_unref(changed);
+}
+
+static guint watch_properties(const gchar *path, const gchar *interface,
+			      pbap_obex_changed_fn changed, gpointer user_data)
+{
+	struct watch *w = g_new0(struct watch, 1);
+
+	w->changed = changed;
+	w->user_data = user_data;
+
+	return g_dbus_connection_signal_subscribe(conn, OBEX_SERVICE,
+			PROPERTIES_INTERFACE, "PropertiesChanged", path,
+			interface, G_DBUS_SIGNAL_FLAGS_NONE,
+			properties_changed_cb, w, g_free);
+}
+
+gboolean pbap_obex_init(pbap_obex_changed_fn transfer_changed)
+{
+	GError *error = NULL;
+
+	if (conn)
+		return TRUE;
+
+	conn = g_bus_get_sync(G_BUS_TYPE_SESSION, NULL, &error);
+	if (!conn) {
+		AFB_ERROR("Failed to connect to session bus: %s", error->message);
+		g_error_free(error);
+		return FALSE;
+	}
+
+	/* transfers are looked up by path, whichever session they are of */
+	watch_properties(NULL, TRANSFER_INTERFACE, transfer_changed, NULL);
+
+	return TRUE;
+}
+
+void pbap_obex_create_session(const gchar *address, GCancellable *cancel,
+			      GAsyncReadyCallback callback, gpointer user_data)
+{
+	GVariantBuilder b;
+
+	g_variant_builder_init(&b, G_VARIANT_TYPE("a{sv}"));
+	g_variant_builder_add(&b, "{sv}", "Target", g_variant_new_string("pbap"));
+
+	call(OBEX_PATH, CLIENT_INTERFACE, "CreateSession",
+	     g_variant_new("(sa{sv})", address, &b), "(o)",
+	     cancel, callback, user_data);
+}
+
+gboolean pbap_obex_create_session_finish(GAsyncResult *res, gchar **spath,
+					 GError **error)
+{
+	GVariant *ret = call_finish(res, error);
+
+	if (!ret)
+		return FALSE;
+
+	g_variant_get(ret, "(o)", spath);
+	g_variant_unref(ret);
+
+	return TRUE;
+}
+
+static void remove_session_cb(GObject *source, GAsyncResult *res,
+			      gpointer user_data)
+{
+	GError *error = NULL;
+	GVariant *ret;
+
+	/* obexd drops sessions by itself once the link is gone */
+	ret = call_finish(res, &error);
+	if (!ret) {
+		AFB_DEBUG("Failed to remove session: %s", error->message);
+		g_error_free(error);
+		return;
+	}
+
+	g_variant_unref(ret);
+}
+
+void pbap_obex_remove_session(const gchar *spath)
+{
+	call(OBEX_PATH, CLIENT_INTERFACE, "RemoveSession",
+	     g_variant_new("(o)", spath), NULL, NULL, remove_session_cb, NULL);
+}
+
+void pbap_obex_get_target(const gchar *spath, GCancellable *cancel,
+			  GAsyncReadyCallback callback, gpointer user_data)
+{
+	call(spath, PROPERTIES_INTERFACE, "Get",
+	     g_variant_new("(ss)", SESSION_INTERFACE, "Target"), "(v)",
+	     cancel, callback, user_data);
+}
+
+gboolean pbap_obex_get_target_finish(GAsyncResult *res, gchar **target,
+				     GError **error)
+{
+	GVariant *ret = call_finish(res, error);
+	GVariant *value;
+
+	if (!ret)
+		return FALSE;
+
+	g_variant_get(ret, "(v)", &value);
+	*target = g_variant_is_of_type(value, G_VARIANT_TYPE_STRING) ?
+		g_variant_dup_string(value, NULL) : NULL;
+	g_variant_unref(value);
+	g_variant_unref(ret);
+
+	return TRUE;
+}
+
+void pbap_obex_select(const gchar *spath, const gchar *location,
+		      const gchar *phonebook, GCancellable *cancel,
+		      GAsyncReadyCallback callback, gpointer user_data)
+{
+	call(spath, PHONEBOOK_INTERFACE, "Select",
+	     g_variant_new("(ss)", location, phonebook), NULL,
+	     cancel, callback, user_data);
+}
+
+gboolean pbap_obex_select_finish(GAsyncResult *res, GError **error)
+{
+	GVariant *ret = call_finish(res, error);
+
+	if (!ret)
+		return FALSE;
+
+	g_variant_unref(ret);
+
+	return TRUE;
+}
+
+void pbap_obex_pull_all(const gchar *spath, const gchar *target,
+			GVariant *filters, GCancellable *cancel,
+			GAsyncReadyCallback callback, gpointer user_data)
+{
+	call(spath, PHONEBOOK_INTERFACE, "PullAll",
+	     g_variant_new("(s@a{sv})", target, filters), "(oa{sv})",
+	     cancel, callback, user_data);
+}
+
+void pbap_obex_pull(const gchar *spath, const gchar *vcard,
+		    const gchar *target, GVariant *filters, GCancellable *cancel,
+		    GAsyncReadyCallback callback, gpointer user_data)
+{
+	call(spath, PHONEBOOK_INTERFACE, "Pull",
+	     g_variant_new("(ss@a{sv})", vcard, target, filters), "(oa{sv})",
+	     cancel, callback, user_data);
+}
+
+gboolean pbap_obex_pull_finish(GAsyncResult *res, gchar **tpath,
+			       GVariant **properties, GError **error)
+{
+	GVariant *ret = call_finish(res, error);
+
+	if (!ret)
+		return FALSE;
+
+	g_variant_get(ret, "(o@a{sv})", tpath, properties);
+	g_variant_unref(ret);
+
+	return TRUE;
+}
+
+void pbap_obex_list(const gchar *spath, GVariant *filters,
+		    GCancellable *cancel, GAsyncReadyCallback callback,
+		    gpointer user_data)
+{
+	call(spath, PHONEBOOK_INTERFACE, "List",
+	     g_variant_new("(@a{sv})", filters), "(a(ss))",
+	     cancel, callback, user_data);
+}
+
+void pbap_obex_search(const gchar *spath, const gchar *field,
+		      const gchar *value, GVariant *filters,
+		      GCancellable *cancel, GAsyncReadyCallback callback,
+		      gpointer user_data)
+{
+	call(spath, PHONEBOOK_INTERFACE, "Search",
+	     g_variant_new("(ss@a{sv})", field, value, filters), "(a(ss))",
+	     cancel, callback, user_data);
+}
+
+gboolean pbap_obex_list_finish(GAsyncResult *res, GVariant **entries,
+			       GError **error)
+{
+	GVariant *ret = call_finish(res, error);
+
+	if (!ret)
+		return FALSE;
+
+	g_variant_get(ret, "(@a(ss))", entries);
+	g_variant_unref(ret);
+
+	return TRUE;
+}
+
+void pbap_obex_get_size(const gchar *spath, GCancellable *cancel,
+			GAsyncReadyCallback callback, gpointer user_data)
+{
+	call(spath, PHONEBOOK_INTERFACE, "GetSize", NULL, "(q)",
+	     cancel, callback, user_data);
+}
+
+gboolean pbap_obex_get_size_finish(GAsyncResult *res, guint16 *size,
+				   GError **error)
+{
+	GVariant *ret = call_finish(res, error);
+
+	if (!ret)
+		return FALSE;
+
+	g_variant_get(ret, "(q)", size);
+	g_variant_unref(ret);
+
+	return TRUE;
+}
+
+guint pbap_obex_watch_phonebook(const gchar *spath,
+				pbap_obex_changed_fn changed,
+				gpointer user_data)
+{
+	return watch_properties(spath, PHONEBOOK_INTERFACE, changed, user_data);
+}
+
+void pbap_obex_unwatch(guint id)
+{
+	g_dbus_connection_signal_unsubscribe(conn, id);
+}
+
+void pbap_obex_cancel_transfer(const gchar *tpath)
+{
+	call(tpath, TRANSFER_INTERFACE, "Cancel", NULL, NULL,
+	     NULL, NULL, NULL);
+}
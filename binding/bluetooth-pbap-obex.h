@@ -0,0 +1,92 @@
+/*
+ * Copyright (C) 2018 Konsulko Group
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef BLUETOOTH_PBAP_OBEX_H
+#define BLUETOOTH_PBAP_OBEX_H
+
+#include <gio/gio.h>
+
+/*
+ * Client of the obexd Client1, Session1, PhonebookAccess1 and Transfer1
+ * interfaces, with method calls and signal subscriptions made straight
+ * on the session bus connection. Only to be used from the main loop of
+ * the binding, which replies and signals are delivered to.
+ */
+
+/* properties of an object that changed, from PropertiesChanged */
+typedef void (*pbap_obex_changed_fn)(const gchar *path, GVariant *changed,
+				     gpointer user_data);
+
+/*
+ * Connect to the session bus and watch for property changes of all
+ * transfers. Returns FALSE on failure, to be retried later.
+ */
+gboolean pbap_obex_init(pbap_obex_changed_fn transfer_changed);
+
+void pbap_obex_create_session(const gchar *address, GCancellable *cancel,
+			      GAsyncReadyCallback callback, gpointer user_data);
+gboolean pbap_obex_create_session_finish(GAsyncResult *res, gchar **spath,
+					 GError **error);
+void pbap_obex_remove_session(const gchar *spath);
+
+/* the Target UUID of a session */
+void pbap_obex_get_target(const gchar *spath, GCancellable *cancel,
+			  GAsyncReadyCallback callback, gpointer user_data);
+gboolean pbap_obex_get_target_finish(GAsyncResult *res, gchar **target,
+				     GError **error);
+
+/* PhonebookAccess1 calls on the object of a session */
+void pbap_obex_select(const gchar *spath, const gchar *location,
+		      const gchar *phonebook, GCancellable *cancel,
+		      GAsyncReadyCallback callback, gpointer user_data);
+gboolean pbap_obex_select_finish(GAsyncResult *res, GError **error);
+
+void pbap_obex_pull_all(const gchar *spath, const gchar *target,
+			GVariant *filters, GCancellable *cancel,
+			GAsyncReadyCallback callback, gpointer user_data);
+void pbap_obex_pull(const gchar *spath, const gchar *vcard,
+		    const gchar *target, GVariant *filters, GCancellable *cancel,
+		    GAsyncReadyCallback callback, gpointer user_data);
+/* the transfer started by Pull or PullAll and its properties */
+gboolean pbap_obex_pull_finish(GAsyncResult *res, gchar **tpath,
+			       GVariant **properties, GError **error);
+
+void pbap_obex_list(const gchar *spath, GVariant *filters,
+		    GCancellable *cancel, GAsyncReadyCallback callback,
+		    gpointer user_data);
+void pbap_obex_search(const gchar *spath, const gchar *field,
+		      const gchar *value, GVariant *filters,
+		      GCancellable *cancel, GAsyncReadyCallback callback,
+		      gpointer user_data);
+/* the a(ss) handles and names found by List or Search */
+gboolean pbap_obex_list_finish(GAsyncResult *res, GVariant **entries,
+			       GError **error);
+
+void pbap_obex_get_size(const gchar *spath, GCancellable *cancel,
+			GAsyncReadyCallback callback, gpointer user_data);
+gboolean pbap_obex_get_size_finish(GAsyncResult *res, guint16 *size,
+				   GError **error);
+
+/* property changes of the phonebook of a session, until unwatched */
+guint pbap_obex_watch_phonebook(const gchar *spath,
+				pbap_obex_changed_fn changed,
+				gpointer user_data);
+void pbap_obex_unwatch(guint id);
+
+void pbap_obex_cancel_transfer(const gchar *tpath);
+
+#endif
@@ -0,0 +1,88 @@
+/*
+ * Copyright (C) 2018 Konsulko Group
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <glib.h>
+#include <json-c/json.h>
+
+#define AFB_BINDING_VERSION 3
+#include <afb/afb-binding.h>
+
+#include "bluetooth-pbap-persist.h"
+
+struct store {
+	gchar *key;
+	struct json_object *query;
+	pbap_persist_cb cb;
+	gpointer user_data;
+};
+
+static void store_done(struct store *st, const char *error)
+{
+	if (st->cb)
+		st->cb(st->key, error, st->user_data);
+
+	g_free(st->key);
+	g_free(st);
+}
+
+static void write_cb(void *closure, struct json_object *result,
+		     const char *error, const char *info, afb_api_t api)
+{
+	struct store *st = closure;
+
+	if (error)
+		AFB_ERROR("Failed to write persistence value '%s': %s",
+			  st->key, error);
+	else
+		AFB_DEBUG("Created persistence value '%s'", st->key);
+
+	store_done(st, error);
+}
+
+static void update_cb(void *closure, struct json_object *result,
+		      const char *error, const char *info, afb_api_t api)
+{
+	struct store *st = closure;
+
+	if (!error) {
+		AFB_DEBUG("Updated persistence value '%s'", st->key);
+		json_object_put(st->query);
+		store_done(st, NULL);
+		return;
+	}
+
+	/* not written yet, the query is handed over */
+	afb_service_call("persistence", "write", st->query, write_cb, st);
+}
+
+void pbap_persist_store(const gchar *key, const gchar *value,
+			pbap_persist_cb cb, gpointer user_data)
+{
+	struct store *st = g_new0(struct store, 1);
+
+	st->key = g_strdup(key);
+	st->cb = cb;
+	st->user_data = user_data;
+
+	st->query = json_object_new_object();
+	json_object_object_add(st->query, "key", json_object_new_string(key));
+	json_object_object_add(st->query, "value", json_object_new_string(value));
+
+	/* kept for the write if the update fails */
+	json_object_get(st->query);
+	afb_service_call("persistence", "update", st->query, update_cb, st);
+}
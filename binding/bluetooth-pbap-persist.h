@@ -0,0 +1,35 @@
+/*
+ * Copyright (C) 2018 Konsulko Group
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef BLUETOOTH_PBAP_PERSIST_H
+#define BLUETOOTH_PBAP_PERSIST_H
+
+#include <glib.h>
+
+/* error is NULL once the value is stored */
+typedef void (*pbap_persist_cb)(const gchar *key, const char *error,
+				gpointer user_data);
+
+/*
+ * Store a value in the persistence binding, updating the key or
+ * writing it if it does not exist yet. The callback, if any, is run
+ * from the thread answering the call.
+ */
+void pbap_persist_store(const gchar *key, const gchar *value,
+			pbap_persist_cb cb, gpointer user_data);
+
+#endif
@@ -0,0 +1,107 @@
+/*
+ * Copyright (C) 2018 Konsulko Group
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <glib.h>
+#include <string.h>
+
+#include "bluetooth-pbap-vcard.h"
+
+#define VCARD_BEGIN	"BEGIN:VCARD"
+#define VCARD_END	"END:VCARD"
+
+GPtrArray *pbap_vcard_split(const gchar *data)
+{
+	GPtrArray *cards = g_ptr_array_new_with_free_func(g_free);
+	const gchar *start = data, *end;
+
+	while ((start = strstr(start, VCARD_BEGIN))) {
+		end = strstr(start, VCARD_END);
+		if (!end)
+			break;
+
+		end += strlen(VCARD_END);
+		if (*end == '\r')
+			end++;
+		if (*end == '\n')
+			end++;
+
+		g_ptr_array_add(cards, g_strndup(start, end - start));
+		start = end;
+	}
+
+	return cards;
+}
+
+/*
+ * Find the next line of property name from *pos, ignoring any group
+ * and parameters. Returns the start of its value and sets *len to its
+ * length without the line ending, or returns NULL.
+ */
+static const gchar *next_property(const gchar **pos, const gchar *name,
+				  gsize *len)
+{
+	gsize name_len = strlen(name), n;
+	const gchar *line, *end, *prop, *value;
+
+	while (**pos) {
+		line = *pos;
+		end = strchr(line, '\n');
+		if (!end)
+			end = line + strlen(line);
+		*pos = *end ? end + 1 : end;
+
+		n = strcspn(line, ";:\n");
+		prop = memchr(line, '.', n);
+		prop = prop ? prop + 1 : line;
+		if (line + n - prop != name_len ||
+		    g_ascii_strncasecmp(prop, name, name_len))
+			continue;
+
+		value = memchr(line + n, ':', end - (line + n));
+		if (!value)
+			continue;
+
+		value++;
+		*len = end - value;
+		if (*len && value[*len - 1] == '\r')
+			(*len)--;
+
+		return value;
+	}
+
+	return NULL;
+}
+
+GPtrArray *pbap_vcard_get_values(const gchar *card, const gchar *name)
+{
+	GPtrArray *values = g_ptr_array_new_with_free_func(g_free);
+	const gchar *pos = card, *value;
+	gsize len;
+
+	while ((value = next_property(&pos, name, &len)))
+		g_ptr_array_add(values, g_strndup(value, len));
+
+	return values;
+}
+
+gboolean pbap_vcard_has_property(const gchar *card, const gchar *name)
+{
+	const gchar *pos = card;
+	gsize len;
+
+	return next_property(&pos, name, &len) != NULL;
+}
@@ -0,0 +1,37 @@
+/*
+ * Copyright (C) 2018 Konsulko Group
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef BLUETOOTH_PBAP_VCARD_H
+#define BLUETOOTH_PBAP_VCARD_H
+
+#include <glib.h>
+
+/*
+ * Split concatenated vCards, as returned by PullAll, into an array
+ * of individual vCard strings in transfer order.
+ */
+GPtrArray *pbap_vcard_split(const gchar *data);
+
+/*
+ * Values of a property of a single vCard, such as "TEL" for both
+ * "TEL;TYPE=CELL:+15035551212" and "item1.TEL:+15035551212". Folded
+ * lines are not joined.
+ */
+GPtrArray *pbap_vcard_get_values(const gchar *card, const gchar *name);
+gboolean pbap_vcard_has_property(const gchar *card, const gchar *name);
+
+#endif
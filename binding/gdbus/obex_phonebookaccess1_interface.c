@@ -1,3205 +0,0 @@
-/*
- * Generated by gdbus-codegen 2.56.3. DO NOT EDIT.
- *
- * The license of this code is the same as for the D-Bus interface description
- * it was derived from.
- */
-
-#ifdef HAVE_CONFIG_H
-#  include "config.h"
-#endif
-
-#include "obex_phonebookaccess1_interface.h"
-
-#include <string.h>
-#ifdef G_OS_UNIX
-#  include <gio/gunixfdlist.h>
-#endif
-
-typedef struct
-{
-  GDBusArgInfo parent_struct;
-  gboolean use_gvariant;
-} _ExtendedGDBusArgInfo;
-
-typedef struct
-{
-  GDBusMethodInfo parent_struct;
-  const gchar *signal_name;
-  gboolean pass_fdlist;
-} _ExtendedGDBusMethodInfo;
-
-typedef struct
-{
-  GDBusSignalInfo parent_struct;
-  const gchar *signal_name;
-} _ExtendedGDBusSignalInfo;
-
-typedef struct
-{
-  GDBusPropertyInfo parent_struct;
-  const gchar *hyphen_name;
-  gboolean use_gvariant;
-} _ExtendedGDBusPropertyInfo;
-
-typedef struct
-{
-  GDBusInterfaceInfo parent_struct;
-  const gchar *hyphen_name;
-} _ExtendedGDBusInterfaceInfo;
-
-typedef struct
-{
-  const _ExtendedGDBusPropertyInfo *info;
-  guint prop_id;
-  GValue orig_value; /* the value before the change */
-} ChangedProperty;
-
-static void
-_changed_property_free (ChangedProperty *data)
-{
-  g_value_unset (&data->orig_value);
-  g_free (data);
-}
-
-static gboolean
-_g_strv_equal0 (gchar **a, gchar **b)
-{
-  gboolean ret = FALSE;
-  guint n;
-  if (a == NULL && b == NULL)
-    {
-      ret = TRUE;
-      goto out;
-    }
-  if (a == NULL || b == NULL)
-    goto out;
-  if (g_strv_length (a) != g_strv_length (b))
-    goto out;
-  for (n = 0; a[n] != NULL; n++)
-    if (g_strcmp0 (a[n], b[n]) != 0)
-      goto out;
-  ret = TRUE;
-out:
-  return ret;
-}
-
-static gboolean
-_g_variant_equal0 (GVariant *a, GVariant *b)
-{
-  gboolean ret = FALSE;
-  if (a == NULL && b == NULL)
-    {
-      ret = TRUE;
-      goto out;
-    }
-  if (a == NULL || b == NULL)
-    goto out;
-  ret = g_variant_equal (a, b);
-out:
-  return ret;
-}
-
-G_GNUC_UNUSED static gboolean
-_g_value_equal (const GValue *a, const GValue *b)
-{
-  gboolean ret = FALSE;
-  g_assert (G_VALUE_TYPE (a) == G_VALUE_TYPE (b));
-  switch (G_VALUE_TYPE (a))
-    {
-      case G_TYPE_BOOLEAN:
-        ret = (g_value_get_boolean (a) == g_value_get_boolean (b));
-        break;
-      case G_TYPE_UCHAR:
-        ret = (g_value_get_uchar (a) == g_value_get_uchar (b));
-        break;
-      case G_TYPE_INT:
-        ret = (g_value_get_int (a) == g_value_get_int (b));
-        break;
-      case G_TYPE_UINT:
-        ret = (g_value_get_uint (a) == g_value_get_uint (b));
-        break;
-      case G_TYPE_INT64:
-        ret = (g_value_get_int64 (a) == g_value_get_int64 (b));
-        break;
-      case G_TYPE_UINT64:
-        ret = (g_value_get_uint64 (a) == g_value_get_uint64 (b));
-        break;
-      case G_TYPE_DOUBLE:
-        {
-          /* Avoid -Wfloat-equal warnings by doing a direct bit compare */
-          gdouble da = g_value_get_double (a);
-          gdouble db = g_value_get_double (b);
-          ret = memcmp (&da, &db, sizeof (gdouble)) == 0;
-        }
-        break;
-      case G_TYPE_STRING:
-        ret = (g_strcmp0 (g_value_get_string (a), g_value_get_string (b)) == 0);
-        break;
-      case G_TYPE_VARIANT:
-        ret = _g_variant_equal0 (g_value_get_variant (a), g_value_get_variant (b));
-        break;
-      default:
-        if (G_VALUE_TYPE (a) == G_TYPE_STRV)
-          ret = _g_strv_equal0 (g_value_get_boxed (a), g_value_get_boxed (b));
-        else
-          g_critical ("_g_value_equal() does not handle type %s", g_type_name (G_VALUE_TYPE (a)));
-        break;
-    }
-  return ret;
-}
-
-/* ------------------------------------------------------------------------
- * Code for interface org.bluez.obex.PhonebookAccess1
- * ------------------------------------------------------------------------
- */
-
-/**
- * SECTION:OrgBluezObexPhonebookAccess1
- * @title: OrgBluezObexPhonebookAccess1
- * @short_description: Generated C code for the org.bluez.obex.PhonebookAccess1 D-Bus interface
- *
- * This section contains code for working with the <link linkend="gdbus-interface-org-bluez-obex-PhonebookAccess1.top_of_page">org.bluez.obex.PhonebookAccess1</link> D-Bus interface in C.
- */
-
-/* ---- Introspection data for org.bluez.obex.PhonebookAccess1 ---- */
-
-static const _ExtendedGDBusArgInfo _org_bluez_obex_phonebook_access1_method_info_select_IN_ARG_location =
-{
-  {
-    -1,
-    (gchar *) "location",
-    (gchar *) "s",
-    NULL
-  },
-  FALSE
-};
-
-static const _ExtendedGDBusArgInfo _org_bluez_obex_phonebook_access1_method_info_select_IN_ARG_phonebook =
-{
-  {
-    -1,
-    (gchar *) "phonebook",
-    (gchar *) "s",
-    NULL
-  },
-  FALSE
-};
-
-static const _ExtendedGDBusArgInfo * const _org_bluez_obex_phonebook_access1_method_info_select_IN_ARG_pointers[] =
-{
-  &_org_bluez_obex_phonebook_access1_method_info_select_IN_ARG_location,
-  &_org_bluez_obex_phonebook_access1_method_info_select_IN_ARG_phonebook,
-  NULL
-};
-
-static const _ExtendedGDBusMethodInfo _org_bluez_obex_phonebook_access1_method_info_select =
-{
-  {
-    -1,
-    (gchar *) "Select",
-    (GDBusArgInfo **) &_org_bluez_obex_phonebook_access1_method_info_select_IN_ARG_pointers,
-    NULL,
-    NULL
-  },
-  "handle-select",
-  FALSE
-};
-
-static const _ExtendedGDBusArgInfo _org_bluez_obex_phonebook_access1_method_info_pull_all_IN_ARG_targetfile =
-{
-  {
-    -1,
-    (gchar *) "targetfile",
-    (gchar *) "s",
-    NULL
-  },
-  FALSE
-};
-
-static const _ExtendedGDBusArgInfo _org_bluez_obex_phonebook_access1_method_info_pull_all_IN_ARG_filters =
-{
-  {
-    -1,
-    (gchar *) "filters",
-    (gchar *) "a{sv}",
-    NULL
-  },
-  FALSE
-};
-
-static const _ExtendedGDBusArgInfo * const _org_bluez_obex_phonebook_access1_method_info_pull_all_IN_ARG_pointers[] =
-{
-  &_org_bluez_obex_phonebook_access1_method_info_pull_all_IN_ARG_targetfile,
-  &_org_bluez_obex_phonebook_access1_method_info_pull_all_IN_ARG_filters,
-  NULL
-};
-
-static const _ExtendedGDBusArgInfo _org_bluez_obex_phonebook_access1_method_info_pull_all_OUT_ARG_transfer =
-{
-  {
-    -1,
-    (gchar *) "transfer",
-    (gchar *) "o",
-    NULL
-  },
-  FALSE
-};
-
-static const _ExtendedGDBusArgInfo _org_bluez_obex_phonebook_access1_method_info_pull_all_OUT_ARG_properties =
-{
-  {
-    -1,
-    (gchar *) "properties",
-    (gchar *) "a{sv}",
-    NULL
-  },
-  FALSE
-};
-
-static const _ExtendedGDBusArgInfo * const _org_bluez_obex_phonebook_access1_method_info_pull_all_OUT_ARG_pointers[] =
-{
-  &_org_bluez_obex_phonebook_access1_method_info_pull_all_OUT_ARG_transfer,
-  &_org_bluez_obex_phonebook_access1_method_info_pull_all_OUT_ARG_properties,
-  NULL
-};
-
-static const _ExtendedGDBusMethodInfo _org_bluez_obex_phonebook_access1_method_info_pull_all =
-{
-  {
-    -1,
-    (gchar *) "PullAll",
-    (GDBusArgInfo **) &_org_bluez_obex_phonebook_access1_method_info_pull_all_IN_ARG_pointers,
-    (GDBusArgInfo **) &_org_bluez_obex_phonebook_access1_method_info_pull_all_OUT_ARG_pointers,
-    NULL
-  },
-  "handle-pull-all",
-  FALSE
-};
-
-static const _ExtendedGDBusArgInfo _org_bluez_obex_phonebook_access1_method_info_pull_IN_ARG_vcard =
-{
-  {
-    -1,
-    (gchar *) "vcard",
-    (gchar *) "s",
-    NULL
-  },
-  FALSE
-};
-
-static const _ExtendedGDBusArgInfo _org_bluez_obex_phonebook_access1_method_info_pull_IN_ARG_targetfile =
-{
-  {
-    -1,
-    (gchar *) "targetfile",
-    (gchar *) "s",
-    NULL
-  },
-  FALSE
-};
-
-static const _ExtendedGDBusArgInfo _org_bluez_obex_phonebook_access1_method_info_pull_IN_ARG_filters =
-{
-  {
-    -1,
-    (gchar *) "filters",
-    (gchar *) "a{sv}",
-    NULL
-  },
-  FALSE
-};
-
-static const _ExtendedGDBusArgInfo * const _org_bluez_obex_phonebook_access1_method_info_pull_IN_ARG_pointers[] =
-{
-  &_org_bluez_obex_phonebook_access1_method_info_pull_IN_ARG_vcard,
-  &_org_bluez_obex_phonebook_access1_method_info_pull_IN_ARG_targetfile,
-  &_org_bluez_obex_phonebook_access1_method_info_pull_IN_ARG_filters,
-  NULL
-};
-
-static const _ExtendedGDBusArgInfo _org_bluez_obex_phonebook_access1_method_info_pull_OUT_ARG_transfer =
-{
-  {
-    -1,
-    (gchar *) "transfer",
-    (gchar *) "o",
-    NULL
-  },
-  FALSE
-};
-
-static const _ExtendedGDBusArgInfo _org_bluez_obex_phonebook_access1_method_info_pull_OUT_ARG_properties =
-{
-  {
-    -1,
-    (gchar *) "properties",
-    (gchar *) "a{sv}",
-    NULL
-  },
-  FALSE
-};
-
-static const _ExtendedGDBusArgInfo * const _org_bluez_obex_phonebook_access1_method_info_pull_OUT_ARG_pointers[] =
-{
-  &_org_bluez_obex_phonebook_access1_method_info_pull_OUT_ARG_transfer,
-  &_org_bluez_obex_phonebook_access1_method_info_pull_OUT_ARG_properties,
-  NULL
-};
-
-static const _ExtendedGDBusMethodInfo _org_bluez_obex_phonebook_access1_method_info_pull =
-{
-  {
-    -1,
-    (gchar *) "Pull",
-    (GDBusArgInfo **) &_org_bluez_obex_phonebook_access1_method_info_pull_IN_ARG_pointers,
-    (GDBusArgInfo **) &_org_bluez_obex_phonebook_access1_method_info_pull_OUT_ARG_pointers,
-    NULL
-  },
-  "handle-pull",
-  FALSE
-};
-
-static const _ExtendedGDBusArgInfo _org_bluez_obex_phonebook_access1_method_info_list_IN_ARG_filters =
-{
-  {
-    -1,
-    (gchar *) "filters",
-    (gchar *) "a{sv}",
-    NULL
-  },
-  FALSE
-};
-
-static const _ExtendedGDBusArgInfo * const _org_bluez_obex_phonebook_access1_method_info_list_IN_ARG_pointers[] =
-{
-  &_org_bluez_obex_phonebook_access1_method_info_list_IN_ARG_filters,
-  NULL
-};
-
-static const _ExtendedGDBusArgInfo _org_bluez_obex_phonebook_access1_method_info_list_OUT_ARG_vcard_listing =
-{
-  {
-    -1,
-    (gchar *) "vcard_listing",
-    (gchar *) "a(ss)",
-    NULL
-  },
-  FALSE
-};
-
-static const _ExtendedGDBusArgInfo * const _org_bluez_obex_phonebook_access1_method_info_list_OUT_ARG_pointers[] =
-{
-  &_org_bluez_obex_phonebook_access1_method_info_list_OUT_ARG_vcard_listing,
-  NULL
-};
-
-static const _ExtendedGDBusMethodInfo _org_bluez_obex_phonebook_access1_method_info_list =
-{
-  {
-    -1,
-    (gchar *) "List",
-    (GDBusArgInfo **) &_org_bluez_obex_phonebook_access1_method_info_list_IN_ARG_pointers,
-    (GDBusArgInfo **) &_org_bluez_obex_phonebook_access1_method_info_list_OUT_ARG_pointers,
-    NULL
-  },
-  "handle-list",
-  FALSE
-};
-
-static const _ExtendedGDBusArgInfo _org_bluez_obex_phonebook_access1_method_info_search_IN_ARG_field =
-{
-  {
-    -1,
-    (gchar *) "field",
-    (gchar *) "s",
-    NULL
-  },
-  FALSE
-};
-
-static const _ExtendedGDBusArgInfo _org_bluez_obex_phonebook_access1_method_info_search_IN_ARG_value =
-{
-  {
-    -1,
-    (gchar *) "value",
-    (gchar *) "s",
-    NULL
-  },
-  FALSE
-};
-
-static const _ExtendedGDBusArgInfo _org_bluez_obex_phonebook_access1_method_info_search_IN_ARG_filters =
-{
-  {
-    -1,
-    (gchar *) "filters",
-    (gchar *) "a{sv}",
-    NULL
-  },
-  FALSE
-};
-
-static const _ExtendedGDBusArgInfo * const _org_bluez_obex_phonebook_access1_method_info_search_IN_ARG_pointers[] =
-{
-  &_org_bluez_obex_phonebook_access1_method_info_search_IN_ARG_field,
-  &_org_bluez_obex_phonebook_access1_method_info_search_IN_ARG_value,
-  &_org_bluez_obex_phonebook_access1_method_info_search_IN_ARG_filters,
-  NULL
-};
-
-static const _ExtendedGDBusArgInfo _org_bluez_obex_phonebook_access1_method_info_search_OUT_ARG_vcard_listing =
-{
-  {
-    -1,
-    (gchar *) "vcard_listing",
-    (gchar *) "a(ss)",
-    NULL
-  },
-  FALSE
-};
-
-static const _ExtendedGDBusArgInfo * const _org_bluez_obex_phonebook_access1_method_info_search_OUT_ARG_pointers[] =
-{
-  &_org_bluez_obex_phonebook_access1_method_info_search_OUT_ARG_vcard_listing,
-  NULL
-};
-
-static const _ExtendedGDBusMethodInfo _org_bluez_obex_phonebook_access1_method_info_search =
-{
-  {
-    -1,
-    (gchar *) "Search",
-    (GDBusArgInfo **) &_org_bluez_obex_phonebook_access1_method_info_search_IN_ARG_pointers,
-    (GDBusArgInfo **) &_org_bluez_obex_phonebook_access1_method_info_search_OUT_ARG_pointers,
-    NULL
-  },
-  "handle-search",
-  FALSE
-};
-
-static const _ExtendedGDBusArgInfo _org_bluez_obex_phonebook_access1_method_info_get_size_OUT_ARG_size =
-{
-  {
-    -1,
-    (gchar *) "size",
-    (gchar *) "q",
-    NULL
-  },
-  FALSE
-};
-
-static const _ExtendedGDBusArgInfo * const _org_bluez_obex_phonebook_access1_method_info_get_size_OUT_ARG_pointers[] =
-{
-  &_org_bluez_obex_phonebook_access1_method_info_get_size_OUT_ARG_size,
-  NULL
-};
-
-static const _ExtendedGDBusMethodInfo _org_bluez_obex_phonebook_access1_method_info_get_size =
-{
-  {
-    -1,
-    (gchar *) "GetSize",
-    NULL,
-    (GDBusArgInfo **) &_org_bluez_obex_phonebook_access1_method_info_get_size_OUT_ARG_pointers,
-    NULL
-  },
-  "handle-get-size",
-  FALSE
-};
-
-static const _ExtendedGDBusArgInfo _org_bluez_obex_phonebook_access1_method_info_list_filter_fields_OUT_ARG_fields =
-{
-  {
-    -1,
-    (gchar *) "fields",
-    (gchar *) "as",
-    NULL
-  },
-  FALSE
-};
-
-static const _ExtendedGDBusArgInfo * const _org_bluez_obex_phonebook_access1_method_info_list_filter_fields_OUT_ARG_pointers[] =
-{
-  &_org_bluez_obex_phonebook_access1_method_info_list_filter_fields_OUT_ARG_fields,
-  NULL
-};
-
-static const _ExtendedGDBusMethodInfo _org_bluez_obex_phonebook_access1_method_info_list_filter_fields =
-{
-  {
-    -1,
-    (gchar *) "ListFilterFields",
-    NULL,
-    (GDBusArgInfo **) &_org_bluez_obex_phonebook_access1_method_info_list_filter_fields_OUT_ARG_pointers,
-    NULL
-  },
-  "handle-list-filter-fields",
-  FALSE
-};
-
-static const _ExtendedGDBusMethodInfo _org_bluez_obex_phonebook_access1_method_info_update_version =
-{
-  {
-    -1,
-    (gchar *) "UpdateVersion",
-    NULL,
-    NULL,
-    NULL
-  },
-  "handle-update-version",
-  FALSE
-};
-
-static const _ExtendedGDBusMethodInfo * const _org_bluez_obex_phonebook_access1_method_info_pointers[] =
-{
-  &_org_bluez_obex_phonebook_access1_method_info_select,
-  &_org_bluez_obex_phonebook_access1_method_info_pull_all,
-  &_org_bluez_obex_phonebook_access1_method_info_pull,
-  &_org_bluez_obex_phonebook_access1_method_info_list,
-  &_org_bluez_obex_phonebook_access1_method_info_search,
-  &_org_bluez_obex_phonebook_access1_method_info_get_size,
-  &_org_bluez_obex_phonebook_access1_method_info_list_filter_fields,
-  &_org_bluez_obex_phonebook_access1_method_info_update_version,
-  NULL
-};
-
-static const _ExtendedGDBusPropertyInfo _org_bluez_obex_phonebook_access1_property_info_folder =
-{
-  {
-    -1,
-    (gchar *) "Folder",
-    (gchar *) "s",
-    G_DBUS_PROPERTY_INFO_FLAGS_READABLE,
-    NULL
-  },
-  "folder",
-  FALSE
-};
-
-static const _ExtendedGDBusPropertyInfo _org_bluez_obex_phonebook_access1_property_info_database_identifier =
-{
-  {
-    -1,
-    (gchar *) "DatabaseIdentifier",
-    (gchar *) "s",
-    G_DBUS_PROPERTY_INFO_FLAGS_READABLE,
-    NULL
-  },
-  "database-identifier",
-  FALSE
-};
-
-static const _ExtendedGDBusPropertyInfo _org_bluez_obex_phonebook_access1_property_info_primary_counter =
-{
-  {
-    -1,
-    (gchar *) "PrimaryCounter",
-    (gchar *) "s",
-    G_DBUS_PROPERTY_INFO_FLAGS_READABLE,
-    NULL
-  },
-  "primary-counter",
-  FALSE
-};
-
-static const _ExtendedGDBusPropertyInfo _org_bluez_obex_phonebook_access1_property_info_secondary_counter =
-{
-  {
-    -1,
-    (gchar *) "SecondaryCounter",
-    (gchar *) "s",
-    G_DBUS_PROPERTY_INFO_FLAGS_READABLE,
-    NULL
-  },
-  "secondary-counter",
-  FALSE
-};
-
-static const _ExtendedGDBusPropertyInfo _org_bluez_obex_phonebook_access1_property_info_fixed_image_size =
-{
-  {
-    -1,
-    (gchar *) "FixedImageSize",
-    (gchar *) "b",
-    G_DBUS_PROPERTY_INFO_FLAGS_READABLE,
-    NULL
-  },
-  "fixed-image-size",
-  FALSE
-};
-
-static const _ExtendedGDBusPropertyInfo * const _org_bluez_obex_phonebook_access1_property_info_pointers[] =
-{
-  &_org_bluez_obex_phonebook_access1_property_info_folder,
-  &_org_bluez_obex_phonebook_access1_property_info_database_identifier,
-  &_org_bluez_obex_phonebook_access1_property_info_primary_counter,
-  &_org_bluez_obex_phonebook_access1_property_info_secondary_counter,
-  &_org_bluez_obex_phonebook_access1_property_info_fixed_image_size,
-  NULL
-};
-
-static const _ExtendedGDBusInterfaceInfo _org_bluez_obex_phonebook_access1_interface_info =
-{
-  {
-    -1,
-    (gchar *) "org.bluez.obex.PhonebookAccess1",
-    (GDBusMethodInfo **) &_org_bluez_obex_phonebook_access1_method_info_pointers,
-    NULL,
-    (GDBusPropertyInfo **) &_org_bluez_obex_phonebook_access1_property_info_pointers,
-    NULL
-  },
-  "org-bluez-obex-phonebook-access1",
-};
-
-
-/**
- * org_bluez_obex_phonebook_access1_interface_info:
- *
- * Gets a machine-readable description of the <link linkend="gdbus-interface-org-bluez-obex-PhonebookAccess1.top_of_page">org.bluez.obex.PhonebookAccess1</link> D-Bus interface.
- *
- * Returns: (transfer none): A #GDBusInterfaceInfo. Do not free.
- */
-GDBusInterfaceInfo *
-org_bluez_obex_phonebook_access1_interface_info (void)
-{
-  return (GDBusInterfaceInfo *) &_org_bluez_obex_phonebook_access1_interface_info.parent_struct;
-}
-
-/**
- * org_bluez_obex_phonebook_access1_override_properties:
- * @klass: The class structure for a #GObject derived class.
- * @property_id_begin: The property id to assign to the first overridden property.
- *
- * Overrides all #GObject properties in the #OrgBluezObexPhonebookAccess1 interface for a concrete class.
- * The properties are overridden in the order they are defined.
- *
- * Returns: The last property id.
- */
-guint
-org_bluez_obex_phonebook_access1_override_properties (GObjectClass *klass, guint property_id_begin)
-{
-  g_object_class_override_property (klass, property_id_begin++, "folder");
-  g_object_class_override_property (klass, property_id_begin++, "database-identifier");
-  g_object_class_override_property (klass, property_id_begin++, "primary-counter");
-  g_object_class_override_property (klass, property_id_begin++, "secondary-counter");
-  g_object_class_override_property (klass, property_id_begin++, "fixed-image-size");
-  return property_id_begin - 1;
-}
-
-
-
-/**
- * OrgBluezObexPhonebookAccess1:
- *
- * Abstract interface type for the D-Bus interface <link linkend="gdbus-interface-org-bluez-obex-PhonebookAccess1.top_of_page">org.bluez.obex.PhonebookAccess1</link>.
- */
-
-/**
- * OrgBluezObexPhonebookAccess1Iface:
- * @parent_iface: The parent interface.
- * @handle_get_size: Handler for the #OrgBluezObexPhonebookAccess1::handle-get-size signal.
- * @handle_list: Handler for the #OrgBluezObexPhonebookAccess1::handle-list signal.
- * @handle_list_filter_fields: Handler for the #OrgBluezObexPhonebookAccess1::handle-list-filter-fields signal.
- * @handle_pull: Handler for the #OrgBluezObexPhonebookAccess1::handle-pull signal.
- * @handle_pull_all: Handler for the #OrgBluezObexPhonebookAccess1::handle-pull-all signal.
- * @handle_search: Handler for the #OrgBluezObexPhonebookAccess1::handle-search signal.
- * @handle_select: Handler for the #OrgBluezObexPhonebookAccess1::handle-select signal.
- * @handle_update_version: Handler for the #OrgBluezObexPhonebookAccess1::handle-update-version signal.
- * @get_database_identifier: Getter for the #OrgBluezObexPhonebookAccess1:database-identifier property.
- * @get_fixed_image_size: Getter for the #OrgBluezObexPhonebookAccess1:fixed-image-size property.
- * @get_folder: Getter for the #OrgBluezObexPhonebookAccess1:folder property.
- * @get_primary_counter: Getter for the #OrgBluezObexPhonebookAccess1:primary-counter property.
- * @get_secondary_counter: Getter for the #OrgBluezObexPhonebookAccess1:secondary-counter property.
- *
- * Virtual table for the D-Bus interface <link linkend="gdbus-interface-org-bluez-obex-PhonebookAccess1.top_of_page">org.bluez.obex.PhonebookAccess1</link>.
- */
-
-typedef OrgBluezObexPhonebookAccess1Iface OrgBluezObexPhonebookAccess1Interface;
-G_DEFINE_INTERFACE (OrgBluezObexPhonebookAccess1, org_bluez_obex_phonebook_access1, G_TYPE_OBJECT)
-
-static void
-org_bluez_obex_phonebook_access1_default_init (OrgBluezObexPhonebookAccess1Iface *iface)
-{
-  /* GObject signals for incoming D-Bus method calls: */
-  /**
-   * OrgBluezObexPhonebookAccess1::handle-select:
-   * @object: A #OrgBluezObexPhonebookAccess1.
-   * @invocation: A #GDBusMethodInvocation.
-   * @arg_location: Argument passed by remote caller.
-   * @arg_phonebook: Argument passed by remote caller.
-   *
-   * Signal emitted when a remote caller is invoking the <link linkend="gdbus-method-org-bluez-obex-PhonebookAccess1.Select">Select()</link> D-Bus method.
-   *
-   * If a signal handler returns %TRUE, it means the signal handler will handle the invocation (e.g. take a reference to @invocation and eventually call org_bluez_obex_phonebook_access1_complete_select() or e.g. g_dbus_method_invocation_return_error() on it) and no order signal handlers will run. If no signal handler handles the invocation, the %G_DBUS_ERROR_UNKNOWN_METHOD error is returned.
-   *
-   * Returns: %TRUE if the invocation was handled, %FALSE to let other signal handlers run.
-   */
-  g_signal_new ("handle-select",
-    G_TYPE_FROM_INTERFACE (iface),
-    G_SIGNAL_RUN_LAST,
-    G_STRUCT_OFFSET (OrgBluezObexPhonebookAccess1Iface, handle_select),
-    g_signal_accumulator_true_handled,
-    NULL,
-    g_cclosure_marshal_generic,
-    G_TYPE_BOOLEAN,
-    3,
-    G_TYPE_DBUS_METHOD_INVOCATION, G_TYPE_STRING, G_TYPE_STRING);
-
-  /**
-   * OrgBluezObexPhonebookAccess1::handle-pull-all:
-   * @object: A #OrgBluezObexPhonebookAccess1.
-   * @invocation: A #GDBusMethodInvocation.
-   * @arg_targetfile: Argument passed by remote caller.
-   * @arg_filters: Argument passed by remote caller.
-   *
-   * Signal emitted when a remote caller is invoking the <link linkend="gdbus-method-org-bluez-obex-PhonebookAccess1.PullAll">PullAll()</link> D-Bus method.
-   *
-   * If a signal handler returns %TRUE, it means the signal handler will handle the invocation (e.g. take a reference to @invocation and eventually call org_bluez_obex_phonebook_access1_complete_pull_all() or e.g. g_dbus_method_invocation_return_error() on it) and no order signal handlers will run. If no signal handler handles the invocation, the %G_DBUS_ERROR_UNKNOWN_METHOD error is returned.
-   *
-   * Returns: %TRUE if the invocation was handled, %FALSE to let other signal handlers run.
-   */
-  g_signal_new ("handle-pull-all",
-    G_TYPE_FROM_INTERFACE (iface),
-    G_SIGNAL_RUN_LAST,
-    G_STRUCT_OFFSET (OrgBluezObexPhonebookAccess1Iface, handle_pull_all),
-    g_signal_accumulator_true_handled,
-    NULL,
-    g_cclosure_marshal_generic,
-    G_TYPE_BOOLEAN,
-    3,
-    G_TYPE_DBUS_METHOD_INVOCATION, G_TYPE_STRING, G_TYPE_VARIANT);
-
-  /**
-   * OrgBluezObexPhonebookAccess1::handle-pull:
-   * @object: A #OrgBluezObexPhonebookAccess1.
-   * @invocation: A #GDBusMethodInvocation.
-   * @arg_vcard: Argument passed by remote caller.
-   * @arg_targetfile: Argument passed by remote caller.
-   * @arg_filters: Argument passed by remote caller.
-   *
-   * Signal emitted when a remote caller is invoking the <link linkend="gdbus-method-org-bluez-obex-PhonebookAccess1.Pull">Pull()</link> D-Bus method.
-   *
-   * If a signal handler returns %TRUE, it means the signal handler will handle the invocation (e.g. take a reference to @invocation and eventually call org_bluez_obex_phonebook_access1_complete_pull() or e.g. g_dbus_method_invocation_return_error() on it) and no order signal handlers will run. If no signal handler handles the invocation, the %G_DBUS_ERROR_UNKNOWN_METHOD error is returned.
-   *
-   * Returns: %TRUE if the invocation was handled, %FALSE to let other signal handlers run.
-   */
-  g_signal_new ("handle-pull",
-    G_TYPE_FROM_INTERFACE (iface),
-    G_SIGNAL_RUN_LAST,
-    G_STRUCT_OFFSET (OrgBluezObexPhonebookAccess1Iface, handle_pull),
-    g_signal_accumulator_true_handled,
-    NULL,
-    g_cclosure_marshal_generic,
-    G_TYPE_BOOLEAN,
-    4,
-    G_TYPE_DBUS_METHOD_INVOCATION, G_TYPE_STRING, G_TYPE_STRING, G_TYPE_VARIANT);
-
-  /**
-   * OrgBluezObexPhonebookAccess1::handle-list:
-   * @object: A #OrgBluezObexPhonebookAccess1.
-   * @invocation: A #GDBusMethodInvocation.
-   * @arg_filters: Argument passed by remote caller.
-   *
-   * Signal emitted when a remote caller is invoking the <link linkend="gdbus-method-org-bluez-obex-PhonebookAccess1.List">List()</link> D-Bus method.
-   *
-   * If a signal handler returns %TRUE, it means the signal handler will handle the invocation (e.g. take a reference to @invocation and eventually call org_bluez_obex_phonebook_access1_complete_list() or e.g. g_dbus_method_invocation_return_error() on it) and no order signal handlers will run. If no signal handler handles the invocation, the %G_DBUS_ERROR_UNKNOWN_METHOD error is returned.
-   *
-   * Returns: %TRUE if the invocation was handled, %FALSE to let other signal handlers run.
-   */
-  g_signal_new ("handle-list",
-    G_TYPE_FROM_INTERFACE (iface),
-    G_SIGNAL_RUN_LAST,
-    G_STRUCT_OFFSET (OrgBluezObexPhonebookAccess1Iface, handle_list),
-    g_signal_accumulator_true_handled,
-    NULL,
-    g_cclosure_marshal_generic,
-    G_TYPE_BOOLEAN,
-    2,
-    G_TYPE_DBUS_METHOD_INVOCATION, G_TYPE_VARIANT);
-
-  /**
-   * OrgBluezObexPhonebookAccess1::handle-search:
-   * @object: A #OrgBluezObexPhonebookAccess1.
-   * @invocation: A #GDBusMethodInvocation.
-   * @arg_field: Argument passed by remote caller.
-   * @arg_value: Argument passed by remote caller.
-   * @arg_filters: Argument passed by remote caller.
-   *
-   * Signal emitted when a remote caller is invoking the <link linkend="gdbus-method-org-bluez-obex-PhonebookAccess1.Search">Search()</link> D-Bus method.
-   *
-   * If a signal handler returns %TRUE, it means the signal handler will handle the invocation (e.g. take a reference to @invocation and eventually call org_bluez_obex_phonebook_access1_complete_search() or e.g. g_dbus_method_invocation_return_error() on it) and no order signal handlers will run. If no signal handler handles the invocation, the %G_DBUS_ERROR_UNKNOWN_METHOD error is returned.
-   *
-   * Returns: %TRUE if the invocation was handled, %FALSE to let other signal handlers run.
-   */
-  g_signal_new ("handle-search",
-    G_TYPE_FROM_INTERFACE (iface),
-    G_SIGNAL_RUN_LAST,
-    G_STRUCT_OFFSET (OrgBluezObexPhonebookAccess1Iface, handle_search),
-    g_signal_accumulator_true_handled,
-    NULL,
-    g_cclosure_marshal_generic,
-    G_TYPE_BOOLEAN,
-    4,
-    G_TYPE_DBUS_METHOD_INVOCATION, G_TYPE_STRING, G_TYPE_STRING, G_TYPE_VARIANT);
-
-  /**
-   * OrgBluezObexPhonebookAccess1::handle-get-size:
-   * @object: A #OrgBluezObexPhonebookAccess1.
-   * @invocation: A #GDBusMethodInvocation.
-   *
-   * Signal emitted when a remote caller is invoking the <link linkend="gdbus-method-org-bluez-obex-PhonebookAccess1.GetSize">GetSize()</link> D-Bus method.
-   *
-   * If a signal handler returns %TRUE, it means the signal handler will handle the invocation (e.g. take a reference to @invocation and eventually call org_bluez_obex_phonebook_access1_complete_get_size() or e.g. g_dbus_method_invocation_return_error() on it) and no order signal handlers will run. If no signal handler handles the invocation, the %G_DBUS_ERROR_UNKNOWN_METHOD error is returned.
-   *
-   * Returns: %TRUE if the invocation was handled, %FALSE to let other signal handlers run.
-   */
-  g_signal_new ("handle-get-size",
-    G_TYPE_FROM_INTERFACE (iface),
-    G_SIGNAL_RUN_LAST,
-    G_STRUCT_OFFSET (OrgBluezObexPhonebookAccess1Iface, handle_get_size),
-    g_signal_accumulator_true_handled,
-    NULL,
-    g_cclosure_marshal_generic,
-    G_TYPE_BOOLEAN,
-    1,
-    G_TYPE_DBUS_METHOD_INVOCATION);
-
-  /**
-   * OrgBluezObexPhonebookAccess1::handle-list-filter-fields:
-   * @object: A #OrgBluezObexPhonebookAccess1.
-   * @invocation: A #GDBusMethodInvocation.
-   *
-   * Signal emitted when a remote caller is invoking the <link linkend="gdbus-method-org-bluez-obex-PhonebookAccess1.ListFilterFields">ListFilterFields()</link> D-Bus method.
-   *
-   * If a signal handler returns %TRUE, it means the signal handler will handle the invocation (e.g. take a reference to @invocation and eventually call org_bluez_obex_phonebook_access1_complete_list_filter_fields() or e.g. g_dbus_method_invocation_return_error() on it) and no order signal handlers will run. If no signal handler handles the invocation, the %G_DBUS_ERROR_UNKNOWN_METHOD error is returned.
-   *
-   * Returns: %TRUE if the invocation was handled, %FALSE to let other signal handlers run.
-   */
-  g_signal_new ("handle-list-filter-fields",
-    G_TYPE_FROM_INTERFACE (iface),
-    G_SIGNAL_RUN_LAST,
-    G_STRUCT_OFFSET (OrgBluezObexPhonebookAccess1Iface, handle_list_filter_fields),
-    g_signal_accumulator_true_handled,
-    NULL,
-    g_cclosure_marshal_generic,
-    G_TYPE_BOOLEAN,
-    1,
-    G_TYPE_DBUS_METHOD_INVOCATION);
-
-  /**
-   * OrgBluezObexPhonebookAccess1::handle-update-version:
-   * @object: A #OrgBluezObexPhonebookAccess1.
-   * @invocation: A #GDBusMethodInvocation.
-   *
-   * Signal emitted when a remote caller is invoking the <link linkend="gdbus-method-org-bluez-obex-PhonebookAccess1.UpdateVersion">UpdateVersion()</link> D-Bus method.
-   *
-   * If a signal handler returns %TRUE, it means the signal handler will handle the invocation (e.g. take a reference to @invocation and eventually call org_bluez_obex_phonebook_access1_complete_update_version() or e.g. g_dbus_method_invocation_return_error() on it) and no order signal handlers will run. If no signal handler handles the invocation, the %G_DBUS_ERROR_UNKNOWN_METHOD error is returned.
-   *
-   * Returns: %TRUE if the invocation was handled, %FALSE to let other signal handlers run.
-   */
-  g_signal_new ("handle-update-version",
-    G_TYPE_FROM_INTERFACE (iface),
-    G_SIGNAL_RUN_LAST,
-    G_STRUCT_OFFSET (OrgBluezObexPhonebookAccess1Iface, handle_update_version),
-    g_signal_accumulator_true_handled,
-    NULL,
-    g_cclosure_marshal_generic,
-    G_TYPE_BOOLEAN,
-    1,
-    G_TYPE_DBUS_METHOD_INVOCATION);
-
-  /* GObject properties for D-Bus properties: */
-  /**
-   * OrgBluezObexPhonebookAccess1:folder:
-   *
-   * Represents the D-Bus property <link linkend="gdbus-property-org-bluez-obex-PhonebookAccess1.Folder">"Folder"</link>.
-   *
-   * Since the D-Bus property for this #GObject property is readable but not writable, it is meaningful to read from it on both the client- and service-side. It is only meaningful, however, to write to it on the service-side.
-   */
-  g_object_interface_install_property (iface,
-    g_param_spec_string ("folder", "Folder", "Folder", NULL, G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
-  /**
-   * OrgBluezObexPhonebookAccess1:database-identifier:
-   *
-   * Represents the D-Bus property <link linkend="gdbus-property-org-bluez-obex-PhonebookAccess1.DatabaseIdentifier">"DatabaseIdentifier"</link>.
-   *
-   * Since the D-Bus property for this #GObject property is readable but not writable, it is meaningful to read from it on both the client- and service-side. It is only meaningful, however, to write to it on the service-side.
-   */
-  g_object_interface_install_property (iface,
-    g_param_spec_string ("database-identifier", "DatabaseIdentifier", "DatabaseIdentifier", NULL, G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
-  /**
-   * OrgBluezObexPhonebookAccess1:primary-counter:
-   *
-   * Represents the D-Bus property <link linkend="gdbus-property-org-bluez-obex-PhonebookAccess1.PrimaryCounter">"PrimaryCounter"</link>.
-   *
-   * Since the D-Bus property for this #GObject property is readable but not writable, it is meaningful to read from it on both the client- and service-side. It is only meaningful, however, to write to it on the service-side.
-   */
-  g_object_interface_install_property (iface,
-    g_param_spec_string ("primary-counter", "PrimaryCounter", "PrimaryCounter", NULL, G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
-  /**
-   * OrgBluezObexPhonebookAccess1:secondary-counter:
-   *
-   * Represents the D-Bus property <link linkend="gdbus-property-org-bluez-obex-PhonebookAccess1.SecondaryCounter">"SecondaryCounter"</link>.
-   *
-   * Since the D-Bus property for this #GObject property is readable but not writable, it is meaningful to read from it on both the client- and service-side. It is only meaningful, however, to write to it on the service-side.
-   */
-  g_object_interface_install_property (iface,
-    g_param_spec_string ("secondary-counter", "SecondaryCounter", "SecondaryCounter", NULL, G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
-  /**
-   * OrgBluezObexPhonebookAccess1:fixed-image-size:
-   *
-   * Represents the D-Bus property <link linkend="gdbus-property-org-bluez-obex-PhonebookAccess1.FixedImageSize">"FixedImageSize"</link>.
-   *
-   * Since the D-Bus property for this #GObject property is readable but not writable, it is meaningful to read from it on both the client- and service-side. It is only meaningful, however, to write to it on the service-side.
-   */
-  g_object_interface_install_property (iface,
-    g_param_spec_boolean ("fixed-image-size", "FixedImageSize", "FixedImageSize", FALSE, G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
-}
-
-/**
- * org_bluez_obex_phonebook_access1_get_folder: (skip)
- * @object: A #OrgBluezObexPhonebookAccess1.
- *
- * Gets the value of the <link linkend="gdbus-property-org-bluez-obex-PhonebookAccess1.Folder">"Folder"</link> D-Bus property.
- *
- * Since this D-Bus property is readable, it is meaningful to use this function on both the client- and service-side.
- *
- * <warning>The returned value is only valid until the property changes so on the client-side it is only safe to use this function on the thread where @object was constructed. Use org_bluez_obex_phonebook_access1_dup_folder() if on another thread.</warning>
- *
- * Returns: (transfer none): The property value or %NULL if the property is not set. Do not free the returned value, it belongs to @object.
- */
-const gchar *
-org_bluez_obex_phonebook_access1_get_folder (OrgBluezObexPhonebookAccess1 *object)
-{
-  return ORG_BLUEZ_OBEX_PHONEBOOK_ACCESS1_GET_IFACE (object)->get_folder (object);
-}
-
-/**
- * org_bluez_obex_phonebook_access1_dup_folder: (skip)
- * @object: A #OrgBluezObexPhonebookAccess1.
- *
- * Gets a copy of the <link linkend="gdbus-property-org-bluez-obex-PhonebookAccess1.Folder">"Folder"</link> D-Bus property.
- *
- * Since this D-Bus property is readable, it is meaningful to use this function on both the client- and service-side.
- *
- * Returns: (transfer full): The property value or %NULL if the property is not set. The returned value should be freed with g_free().
- */
-gchar *
-org_bluez_obex_phonebook_access1_dup_folder (OrgBluezObexPhonebookAccess1 *object)
-{
-  gchar *value;
-  g_object_get (G_OBJECT (object), "folder", &value, NULL);
-  return value;
-}
-
-/**
- * org_bluez_obex_phonebook_access1_set_folder: (skip)
- * @object: A #OrgBluezObexPhonebookAccess1.
- * @value: The value to set.
- *
- * Sets the <link linkend="gdbus-property-org-bluez-obex-PhonebookAccess1.Folder">"Folder"</link> D-Bus property to @value.
- *
- * Since this D-Bus property is not writable, it is only meaningful to use this function on the service-side.
- */
-void
-org_bluez_obex_phonebook_access1_set_folder (OrgBluezObexPhonebookAccess1 *object, const gchar *value)
-{
-  g_object_set (G_OBJECT (object), "folder", value, NULL);
-}
-
-/**
- * org_bluez_obex_phonebook_access1_get_database_identifier: (skip)
- * @object: A #OrgBluezObexPhonebookAccess1.
- *
- * Gets the value of the <link linkend="gdbus-property-org-bluez-obex-PhonebookAccess1.DatabaseIdentifier">"DatabaseIdentifier"</link> D-Bus property.
- *
- * Since this D-Bus property is readable, it is meaningful to use this function on both the client- and service-side.
- *
- * <warning>The returned value is only valid until the property changes so on the client-side it is only safe to use this function on the thread where @object was constructed. Use org_bluez_obex_phonebook_access1_dup_database_identifier() if on another thread.</warning>
- *
- * Returns: (transfer none): The property value or %NULL if the property is not set. Do not free the returned value, it belongs to @object.
- */
-const gchar *
-org_bluez_obex_phonebook_access1_get_database_identifier (OrgBluezObexPhonebookAccess1 *object)
-{
-  return ORG_BLUEZ_OBEX_PHONEBOOK_ACCESS1_GET_IFACE (object)->get_database_identifier (object);
-}
-
-/**
- * org_bluez_obex_phonebook_access1_dup_database_identifier: (skip)
- * @object: A #OrgBluezObexPhonebookAccess1.
- *
- * Gets a copy of the <link linkend="gdbus-property-org-bluez-obex-PhonebookAccess1.DatabaseIdentifier">"DatabaseIdentifier"</link> D-Bus property.
- *
- * Since this D-Bus property is readable, it is meaningful to use this function on both the client- and service-side.
- *
- * Returns: (transfer full): The property value or %NULL if the property is not set. The returned value should be freed with g_free().
- */
-gchar *
-org_bluez_obex_phonebook_access1_dup_database_identifier (OrgBluezObexPhonebookAccess1 *object)
-{
-  gchar *value;
-  g_object_get (G_OBJECT (object), "database-identifier", &value, NULL);
-  return value;
-}
-
-/**
- * org_bluez_obex_phonebook_access1_set_database_identifier: (skip)
- * @object: A #OrgBluezObexPhonebookAccess1.
- * @value: The value to set.
- *
- * Sets the <link linkend="gdbus-property-org-bluez-obex-PhonebookAccess1.DatabaseIdentifier">"DatabaseIdentifier"</link> D-Bus property to @value.
- *
- * Since this D-Bus property is not writable, it is only meaningful to use this function on the service-side.
- */
-void
-org_bluez_obex_phonebook_access1_set_database_identifier (OrgBluezObexPhonebookAccess1 *object, const gchar *value)
-{
-  g_object_set (G_OBJECT (object), "database-identifier", value, NULL);
-}
-
-/**
- * org_bluez_obex_phonebook_access1_get_primary_counter: (skip)
- * @object: A #OrgBluezObexPhonebookAccess1.
- *
- * Gets the value of the <link linkend="gdbus-property-org-bluez-obex-PhonebookAccess1.PrimaryCounter">"PrimaryCounter"</link> D-Bus property.
- *
- * Since this D-Bus property is readable, it is meaningful to use this function on both the client- and service-side.
- *
- * <warning>The returned value is only valid until the property changes so on the client-side it is only safe to use this function on the thread where @object was constructed. Use org_bluez_obex_phonebook_access1_dup_primary_counter() if on another thread.</warning>
- *
- * Returns: (transfer none): The property value or %NULL if the property is not set. Do not free the returned value, it belongs to @object.
- */
-const gchar *
-org_bluez_obex_phonebook_access1_get_primary_counter (OrgBluezObexPhonebookAccess1 *object)
-{
-  return ORG_BLUEZ_OBEX_PHONEBOOK_ACCESS1_GET_IFACE (object)->get_primary_counter (object);
-}
-
-/**
- * org_bluez_obex_phonebook_access1_dup_primary_counter: (skip)
- * @object: A #OrgBluezObexPhonebookAccess1.
- *
- * Gets a copy of the <link linkend="gdbus-property-org-bluez-obex-PhonebookAccess1.PrimaryCounter">"PrimaryCounter"</link> D-Bus property.
- *
- * Since this D-Bus property is readable, it is meaningful to use this function on both the client- and service-side.
- *
- * Returns: (transfer full): The property value or %NULL if the property is not set. The returned value should be freed with g_free().
- */
-gchar *
-org_bluez_obex_phonebook_access1_dup_primary_counter (OrgBluezObexPhonebookAccess1 *object)
-{
-  gchar *value;
-  g_object_get (G_OBJECT (object), "primary-counter", &value, NULL);
-  return value;
-}
-
-/**
- * org_bluez_obex_phonebook_access1_set_primary_counter: (skip)
- * @object: A #OrgBluezObexPhonebookAccess1.
- * @value: The value to set.
- *
- * Sets the <link linkend="gdbus-property-org-bluez-obex-PhonebookAccess1.PrimaryCounter">"PrimaryCounter"</link> D-Bus property to @value.
- *
- * Since this D-Bus property is not writable, it is only meaningful to use this function on the service-side.
- */
-void
-org_bluez_obex_phonebook_access1_set_primary_counter (OrgBluezObexPhonebookAccess1 *object, const gchar *value)
-{
-  g_object_set (G_OBJECT (object), "primary-counter", value, NULL);
-}
-
-/**
- * org_bluez_obex_phonebook_access1_get_secondary_counter: (skip)
- * @object: A #OrgBluezObexPhonebookAccess1.
- *
- * Gets the value of the <link linkend="gdbus-property-org-bluez-obex-PhonebookAccess1.SecondaryCounter">"SecondaryCounter"</link> D-Bus property.
- *
- * Since this D-Bus property is readable, it is meaningful to use this function on both the client- and service-side.
- *
- * <warning>The returned value is only valid until the property changes so on the client-side it is only safe to use this function on the thread where @object was constructed. Use org_bluez_obex_phonebook_access1_dup_secondary_counter() if on another thread.</warning>
- *
- * Returns: (transfer none): The property value or %NULL if the property is not set. Do not free the returned value, it belongs to @object.
- */
-const gchar *
-org_bluez_obex_phonebook_access1_get_secondary_counter (OrgBluezObexPhonebookAccess1 *object)
-{
-  return ORG_BLUEZ_OBEX_PHONEBOOK_ACCESS1_GET_IFACE (object)->get_secondary_counter (object);
-}
-
-/**
- * org_bluez_obex_phonebook_access1_dup_secondary_counter: (skip)
- * @object: A #OrgBluezObexPhonebookAccess1.
- *
- * Gets a copy of the <link linkend="gdbus-property-org-bluez-obex-PhonebookAccess1.SecondaryCounter">"SecondaryCounter"</link> D-Bus property.
- *
- * Since this D-Bus property is readable, it is meaningful to use this function on both the client- and service-side.
- *
- * Returns: (transfer full): The property value or %NULL if the property is not set. The returned value should be freed with g_free().
- */
-gchar *
-org_bluez_obex_phonebook_access1_dup_secondary_counter (OrgBluezObexPhonebookAccess1 *object)
-{
-  gchar *value;
-  g_object_get (G_OBJECT (object), "secondary-counter", &value, NULL);
-  return value;
-}
-
-/**
- * org_bluez_obex_phonebook_access1_set_secondary_counter: (skip)
- * @object: A #OrgBluezObexPhonebookAccess1.
- * @value: The value to set.
- *
- * Sets the <link linkend="gdbus-property-org-bluez-obex-PhonebookAccess1.SecondaryCounter">"SecondaryCounter"</link> D-Bus property to @value.
- *
- * Since this D-Bus property is not writable, it is only meaningful to use this function on the service-side.
- */
-void
-org_bluez_obex_phonebook_access1_set_secondary_counter (OrgBluezObexPhonebookAccess1 *object, const gchar *value)
-{
-  g_object_set (G_OBJECT (object), "secondary-counter", value, NULL);
-}
-
-/**
- * org_bluez_obex_phonebook_access1_get_fixed_image_size: (skip)
- * @object: A #OrgBluezObexPhonebookAccess1.
- *
- * Gets the value of the <link linkend="gdbus-property-org-bluez-obex-PhonebookAccess1.FixedImageSize">"FixedImageSize"</link> D-Bus property.
- *
- * Since this D-Bus property is readable, it is meaningful to use this function on both the client- and service-side.
- *
- * Returns: The property value.
- */
-gboolean 
-org_bluez_obex_phonebook_access1_get_fixed_image_size (OrgBluezObexPhonebookAccess1 *object)
-{
-  return ORG_BLUEZ_OBEX_PHONEBOOK_ACCESS1_GET_IFACE (object)->get_fixed_image_size (object);
-}
-
-/**
- * org_bluez_obex_phonebook_access1_set_fixed_image_size: (skip)
- * @object: A #OrgBluezObexPhonebookAccess1.
- * @value: The value to set.
- *
- * Sets the <link linkend="gdbus-property-org-bluez-obex-PhonebookAccess1.FixedImageSize">"FixedImageSize"</link> D-Bus property to @value.
- *
- * Since this D-Bus property is not writable, it is only meaningful to use this function on the service-side.
- */
-void
-org_bluez_obex_phonebook_access1_set_fixed_image_size (OrgBluezObexPhonebookAccess1 *object, gboolean value)
-{
-  g_object_set (G_OBJECT (object), "fixed-image-size", value, NULL);
-}
-
-/**
- * org_bluez_obex_phonebook_access1_call_select:
- * @proxy: A #OrgBluezObexPhonebookAccess1Proxy.
- * @arg_location: Argument to pass with the method invocation.
- * @arg_phonebook: Argument to pass with the method invocation.
- * @cancellable: (nullable): A #GCancellable or %NULL.
- * @callback: A #GAsyncReadyCallback to call when the request is satisfied or %NULL.
- * @user_data: User data to pass to @callback.
- *
- * Asynchronously invokes the <link linkend="gdbus-method-org-bluez-obex-PhonebookAccess1.Select">Select()</link> D-Bus method on @proxy.
- * When the operation is finished, @callback will be invoked in the <link linkend="g-main-context-push-thread-default">thread-default main loop</link> of the thread you are calling this method from.
- * You can then call org_bluez_obex_phonebook_access1_call_select_finish() to get the result of the operation.
- *
- * See org_bluez_obex_phonebook_access1_call_select_sync() for the synchronous, blocking version of this method.
- */
-void
-org_bluez_obex_phonebook_access1_call_select (
-    OrgBluezObexPhonebookAccess1 *proxy,
-    const gchar *arg_location,
-    const gchar *arg_phonebook,
-    GCancellable *cancellable,
-    GAsyncReadyCallback callback,
-    gpointer user_data)
-{
-  g_dbus_proxy_call (G_DBUS_PROXY (proxy),
-    "Select",
-    g_variant_new ("(ss)",
-                   arg_location,
-                   arg_phonebook),
-    G_DBUS_CALL_FLAGS_NONE,
-    -1,
-    cancellable,
-    callback,
-    user_data);
-}
-
-/**
- * org_bluez_obex_phonebook_access1_call_select_finish:
- * @proxy: A #OrgBluezObexPhonebookAccess1Proxy.
- * @res: The #GAsyncResult obtained from the #GAsyncReadyCallback passed to org_bluez_obex_phonebook_access1_call_select().
- * @error: Return location for error or %NULL.
- *
- * Finishes an operation started with org_bluez_obex_phonebook_access1_call_select().
- *
- * Returns: (skip): %TRUE if the call succeded, %FALSE if @error is set.
- */
-gboolean
-org_bluez_obex_phonebook_access1_call_select_finish (
-    OrgBluezObexPhonebookAccess1 *proxy,
-    GAsyncResult *res,
-    GError **error)
-{
-  GVariant *_ret;
-  _ret = g_dbus_proxy_call_finish (G_DBUS_PROXY (proxy), res, error);
-  if (_ret == NULL)
-    goto _out;
-  g_variant_get (_ret,
-                 "()");
-  g_variant_unref (_ret);
-_out:
-  return _ret != NULL;
-}
-
-/**
- * org_bluez_obex_phonebook_access1_call_select_sync:
- * @proxy: A #OrgBluezObexPhonebookAccess1Proxy.
- * @arg_location: Argument to pass with the method invocation.
- * @arg_phonebook: Argument to pass with the method invocation.
- * @cancellable: (nullable): A #GCancellable or %NULL.
- * @error: Return location for error or %NULL.
- *
- * Synchronously invokes the <link linkend="gdbus-method-org-bluez-obex-PhonebookAccess1.Select">Select()</link> D-Bus method on @proxy. The calling thread is blocked until a reply is received.
- *
- * See org_bluez_obex_phonebook_access1_call_select() for the asynchronous version of this method.
- *
- * Returns: (skip): %TRUE if the call succeded, %FALSE if @error is set.
- */
-gboolean
-org_bluez_obex_phonebook_access1_call_select_sync (
-    OrgBluezObexPhonebookAccess1 *proxy,
-    const gchar *arg_location,
-    const gchar *arg_phonebook,
-    GCancellable *cancellable,
-    GError **error)
-{
-  GVariant *_ret;
-  _ret = g_dbus_proxy_call_sync (G_DBUS_PROXY (proxy),
-    "Select",
-    g_variant_new ("(ss)",
-                   arg_location,
-                   arg_phonebook),
-    G_DBUS_CALL_FLAGS_NONE,
-    -1,
-    cancellable,
-    error);
-  if (_ret == NULL)
-    goto _out;
-  g_variant_get (_ret,
-                 "()");
-  g_variant_unref (_ret);
-_out:
-  return _ret != NULL;
-}
-
-/**
- * org_bluez_obex_phonebook_access1_call_pull_all:
- * @proxy: A #OrgBluezObexPhonebookAccess1Proxy.
- * @arg_targetfile: Argument to pass with the method invocation.
- * @arg_filters: Argument to pass with the method invocation.
- * @cancellable: (nullable): A #GCancellable or %NULL.
- * @callback: A #GAsyncReadyCallback to call when the request is satisfied or %NULL.
- * @user_data: User data to pass to @callback.
- *
- * Asynchronously invokes the <link linkend="gdbus-method-org-bluez-obex-PhonebookAccess1.PullAll">PullAll()</link> D-Bus method on @proxy.
- * When the operation is finished, @callback will be invoked in the <link linkend="g-main-context-push-thread-default">thread-default main loop</link> of the thread you are calling this method from.
- * You can then call org_bluez_obex_phonebook_access1_call_pull_all_finish() to get the result of the operation.
- *
- * See org_bluez_obex_phonebook_access1_call_pull_all_sync() for the synchronous, blocking version of this method.
- */
-void
-org_bluez_obex_phonebook_access1_call_pull_all (
-    OrgBluezObexPhonebookAccess1 *proxy,
-    const gchar *arg_targetfile,
-    GVariant *arg_filters,
-    GCancellable *cancellable,
-    GAsyncReadyCallback callback,
-    gpointer user_data)
-{
-  g_dbus_proxy_call (G_DBUS_PROXY (proxy),
-    "PullAll",
-    g_variant_new ("(s@a{sv})",
-                   arg_targetfile,
-                   arg_filters),
-    G_DBUS_CALL_FLAGS_NONE,
-    -1,
-    cancellable,
-    callback,
-    user_data);
-}
-
-/**
- * org_bluez_obex_phonebook_access1_call_pull_all_finish:
- * @proxy: A #OrgBluezObexPhonebookAccess1Proxy.
- * @out_transfer: (out): Return location for return parameter or %NULL to ignore.
- * @out_properties: (out): Return location for return parameter or %NULL to ignore.
- * @res: The #GAsyncResult obtained from the #GAsyncReadyCallback passed to org_bluez_obex_phonebook_access1_call_pull_all().
- * @error: Return location for error or %NULL.
- *
- * Finishes an operation started with org_bluez_obex_phonebook_access1_call_pull_all().
- *
- * Returns: (skip): %TRUE if the call succeded, %FALSE if @error is set.
- */
-gboolean
-org_bluez_obex_phonebook_access1_call_pull_all_finish (
-    OrgBluezObexPhonebookAccess1 *proxy,
-    gchar **out_transfer,
-    GVariant **out_properties,
-    GAsyncResult *res,
-    GError **error)
-{
-  GVariant *_ret;
-  _ret = g_dbus_proxy_call_finish (G_DBUS_PROXY (proxy), res, error);
-  if (_ret == NULL)
-    goto _out;
-  g_variant_get (_ret,
-                 "(o@a{sv})",
-                 out_transfer,
-                 out_properties);
-  g_variant_unref (_ret);
-_out:
-  return _ret != NULL;
-}
-
-/**
- * org_bluez_obex_phonebook_access1_call_pull_all_sync:
- * @proxy: A #OrgBluezObexPhonebookAccess1Proxy.
- * @arg_targetfile: Argument to pass with the method invocation.
- * @arg_filters: Argument to pass with the method invocation.
- * @out_transfer: (out): Return location for return parameter or %NULL to ignore.
- * @out_properties: (out): Return location for return parameter or %NULL to ignore.
- * @cancellable: (nullable): A #GCancellable or %NULL.
- * @error: Return location for error or %NULL.
- *
- * Synchronously invokes the <link linkend="gdbus-method-org-bluez-obex-PhonebookAccess1.PullAll">PullAll()</link> D-Bus method on @proxy. The calling thread is blocked until a reply is received.
- *
- * See org_bluez_obex_phonebook_access1_call_pull_all() for the asynchronous version of this method.
- *
- * Returns: (skip): %TRUE if the call succeded, %FALSE if @error is set.
- */
-gboolean
-org_bluez_obex_phonebook_access1_call_pull_all_sync (
-    OrgBluezObexPhonebookAccess1 *proxy,
-    const gchar *arg_targetfile,
-    GVariant *arg_filters,
-    gchar **out_transfer,
-    GVariant **out_properties,
-    GCancellable *cancellable,
-    GError **error)
-{
-  GVariant *_ret;
-  _ret = g_dbus_proxy_call_sync (G_DBUS_PROXY (proxy),
-    "PullAll",
-    g_variant_new ("(s@a{sv})",
-                   arg_targetfile,
-                   arg_filters),
-    G_DBUS_CALL_FLAGS_NONE,
-    -1,
-    cancellable,
-    error);
-  if (_ret == NULL)
-    goto _out;
-  g_variant_get (_ret,
-                 "(o@a{sv})",
-                 out_transfer,
-                 out_properties);
-  g_variant_unref (_ret);
-_out:
-  return _ret != NULL;
-}
-
-/**
- * org_bluez_obex_phonebook_access1_call_pull:
- * @proxy: A #OrgBluezObexPhonebookAccess1Proxy.
- * @arg_vcard: Argument to pass with the method invocation.
- * @arg_targetfile: Argument to pass with the method invocation.
- * @arg_filters: Argument to pass with the method invocation.
- * @cancellable: (nullable): A #GCancellable or %NULL.
- * @callback: A #GAsyncReadyCallback to call when the request is satisfied or %NULL.
- * @user_data: User data to pass to @callback.
- *
- * Asynchronously invokes the <link linkend="gdbus-method-org-bluez-obex-PhonebookAccess1.Pull">Pull()</link> D-Bus method on @proxy.
- * When the operation is finished, @callback will be invoked in the <link linkend="g-main-context-push-thread-default">thread-default main loop</link> of the thread you are calling this method from.
- * You can then call org_bluez_obex_phonebook_access1_call_pull_finish() to get the result of the operation.
- *
- * See org_bluez_obex_phonebook_access1_call_pull_sync() for the synchronous, blocking version of this method.
- */
-void
-org_bluez_obex_phonebook_access1_call_pull (
-    OrgBluezObexPhonebookAccess1 *proxy,
-    const gchar *arg_vcard,
-    const gchar *arg_targetfile,
-    GVariant *arg_filters,
-    GCancellable *cancellable,
-    GAsyncReadyCallback callback,
-    gpointer user_data)
-{
-  g_dbus_proxy_call (G_DBUS_PROXY (proxy),
-    "Pull",
-    g_variant_new ("(ss@a{sv})",
-                   arg_vcard,
-                   arg_targetfile,
-                   arg_filters),
-    G_DBUS_CALL_FLAGS_NONE,
-    -1,
-    cancellable,
-    callback,
-    user_data);
-}
-
-/**
- * org_bluez_obex_phonebook_access1_call_pull_finish:
- * @proxy: A #OrgBluezObexPhonebookAccess1Proxy.
- * @out_transfer: (out): Return location for return parameter or %NULL to ignore.
- * @out_properties: (out): Return location for return parameter or %NULL to ignore.
- * @res: The #GAsyncResult obtained from the #GAsyncReadyCallback passed to org_bluez_obex_phonebook_access1_call_pull().
- * @error: Return location for error or %NULL.
- *
- * Finishes an operation started with org_bluez_obex_phonebook_access1_call_pull().
- *
- * Returns: (skip): %TRUE if the call succeded, %FALSE if @error is set.
- */
-gboolean
-org_bluez_obex_phonebook_access1_call_pull_finish (
-    OrgBluezObexPhonebookAccess1 *proxy,
-    gchar **out_transfer,
-    GVariant **out_properties,
-    GAsyncResult *res,
-    GError **error)
-{
-  GVariant *_ret;
-  _ret = g_dbus_proxy_call_finish (G_DBUS_PROXY (proxy), res, error);
-  if (_ret == NULL)
-    goto _out;
-  g_variant_get (_ret,
-                 "(o@a{sv})",
-                 out_transfer,
-                 out_properties);
-  g_variant_unref (_ret);
-_out:
-  return _ret != NULL;
-}
-
-/**
- * org_bluez_obex_phonebook_access1_call_pull_sync:
- * @proxy: A #OrgBluezObexPhonebookAccess1Proxy.
- * @arg_vcard: Argument to pass with the method invocation.
- * @arg_targetfile: Argument to pass with the method invocation.
- * @arg_filters: Argument to pass with the method invocation.
- * @out_transfer: (out): Return location for return parameter or %NULL to ignore.
- * @out_properties: (out): Return location for return parameter or %NULL to ignore.
- * @cancellable: (nullable): A #GCancellable or %NULL.
- * @error: Return location for error or %NULL.
- *
- * Synchronously invokes the <link linkend="gdbus-method-org-bluez-obex-PhonebookAccess1.Pull">Pull()</link> D-Bus method on @proxy. The calling thread is blocked until a reply is received.
- *
- * See org_bluez_obex_phonebook_access1_call_pull() for the asynchronous version of this method.
- *
- * Returns: (skip): %TRUE if the call succeded, %FALSE if @error is set.
- */
-gboolean
-org_bluez_obex_phonebook_access1_call_pull_sync (
-    OrgBluezObexPhonebookAccess1 *proxy,
-    const gchar *arg_vcard,
-    const gchar *arg_targetfile,
-    GVariant *arg_filters,
-    gchar **out_transfer,
-    GVariant **out_properties,
-    GCancellable *cancellable,
-    GError **error)
-{
-  GVariant *_ret;
-  _ret = g_dbus_proxy_call_sync (G_DBUS_PROXY (proxy),
-    "Pull",
-    g_variant_new ("(ss@a{sv})",
-                   arg_vcard,
-                   arg_targetfile,
-                   arg_filters),
-    G_DBUS_CALL_FLAGS_NONE,
-    -1,
-    cancellable,
-    error);
-  if (_ret == NULL)
-    goto _out;
-  g_variant_get (_ret,
-                 "(o@a{sv})",
-                 out_transfer,
-                 out_properties);
-  g_variant_unref (_ret);
-_out:
-  return _ret != NULL;
-}
-
-/**
- * org_bluez_obex_phonebook_access1_call_list:
- * @proxy: A #OrgBluezObexPhonebookAccess1Proxy.
- * @arg_filters: Argument to pass with the method invocation.
- * @cancellable: (nullable): A #GCancellable or %NULL.
- * @callback: A #GAsyncReadyCallback to call when the request is satisfied or %NULL.
- * @user_data: User data to pass to @callback.
- *
- * Asynchronously invokes the <link linkend="gdbus-method-org-bluez-obex-PhonebookAccess1.List">List()</link> D-Bus method on @proxy.
- * When the operation is finished, @callback will be invoked in the <link linkend="g-main-context-push-thread-default">thread-default main loop</link> of the thread you are calling this method from.
- * You can then call org_bluez_obex_phonebook_access1_call_list_finish() to get the result of the operation.
- *
- * See org_bluez_obex_phonebook_access1_call_list_sync() for the synchronous, blocking version of this method.
- */
-void
-org_bluez_obex_phonebook_access1_call_list (
-    OrgBluezObexPhonebookAccess1 *proxy,
-    GVariant *arg_filters,
-    GCancellable *cancellable,
-    GAsyncReadyCallback callback,
-    gpointer user_data)
-{
-  g_dbus_proxy_call (G_DBUS_PROXY (proxy),
-    "List",
-    g_variant_new ("(@a{sv})",
-                   arg_filters),
-    G_DBUS_CALL_FLAGS_NONE,
-    -1,
-    cancellable,
-    callback,
-    user_data);
-}
-
-/**
- * org_bluez_obex_phonebook_access1_call_list_finish:
- * @proxy: A #OrgBluezObexPhonebookAccess1Proxy.
- * @out_vcard_listing: (out): Return location for return parameter or %NULL to ignore.
- * @res: The #GAsyncResult obtained from the #GAsyncReadyCallback passed to org_bluez_obex_phonebook_access1_call_list().
- * @error: Return location for error or %NULL.
- *
- * Finishes an operation started with org_bluez_obex_phonebook_access1_call_list().
- *
- * Returns: (skip): %TRUE if the call succeded, %FALSE if @error is set.
- */
-gboolean
-org_bluez_obex_phonebook_access1_call_list_finish (
-    OrgBluezObexPhonebookAccess1 *proxy,
-    GVariant **out_vcard_listing,
-    GAsyncResult *res,
-    GError **error)
-{
-  GVariant *_ret;
-  _ret = g_dbus_proxy_call_finish (G_DBUS_PROXY (proxy), res, error);
-  if (_ret == NULL)
-    goto _out;
-  g_variant_get (_ret,
-                 "(@a(ss))",
-                 out_vcard_listing);
-  g_variant_unref (_ret);
-_out:
-  return _ret != NULL;
-}
-
-/**
- * org_bluez_obex_phonebook_access1_call_list_sync:
- * @proxy: A #OrgBluezObexPhonebookAccess1Proxy.
- * @arg_filters: Argument to pass with the method invocation.
- * @out_vcard_listing: (out): Return location for return parameter or %NULL to ignore.
- * @cancellable: (nullable): A #GCancellable or %NULL.
- * @error: Return location for error or %NULL.
- *
- * Synchronously invokes the <link linkend="gdbus-method-org-bluez-obex-PhonebookAccess1.List">List()</link> D-Bus method on @proxy. The calling thread is blocked until a reply is received.
- *
- * See org_bluez_obex_phonebook_access1_call_list() for the asynchronous version of this method.
- *
- * Returns: (skip): %TRUE if the call succeded, %FALSE if @error is set.
- */
-gboolean
-org_bluez_obex_phonebook_access1_call_list_sync (
-    OrgBluezObexPhonebookAccess1 *proxy,
-    GVariant *arg_filters,
-    GVariant **out_vcard_listing,
-    GCancellable *cancellable,
-    GError **error)
-{
-  GVariant *_ret;
-  _ret = g_dbus_proxy_call_sync (G_DBUS_PROXY (proxy),
-    "List",
-    g_variant_new ("(@a{sv})",
-                   arg_filters),
-    G_DBUS_CALL_FLAGS_NONE,
-    -1,
-    cancellable,
-    error);
-  if (_ret == NULL)
-    goto _out;
-  g_variant_get (_ret,
-                 "(@a(ss))",
-                 out_vcard_listing);
-  g_variant_unref (_ret);
-_out:
-  return _ret != NULL;
-}
-
-/**
- * org_bluez_obex_phonebook_access1_call_search:
- * @proxy: A #OrgBluezObexPhonebookAccess1Proxy.
- * @arg_field: Argument to pass with the method invocation.
- * @arg_value: Argument to pass with the method invocation.
- * @arg_filters: Argument to pass with the method invocation.
- * @cancellable: (nullable): A #GCancellable or %NULL.
- * @callback: A #GAsyncReadyCallback to call when the request is satisfied or %NULL.
- * @user_data: User data to pass to @callback.
- *
- * Asynchronously invokes the <link linkend="gdbus-method-org-bluez-obex-PhonebookAccess1.Search">Search()</link> D-Bus method on @proxy.
- * When the operation is finished, @callback will be invoked in the <link linkend="g-main-context-push-thread-default">thread-default main loop</link> of the thread you are calling this method from.
- * You can then call org_bluez_obex_phonebook_access1_call_search_finish() to get the result of the operation.
- *
- * See org_bluez_obex_phonebook_access1_call_search_sync() for the synchronous, blocking version of this method.
- */
-void
-org_bluez_obex_phonebook_access1_call_search (
-    OrgBluezObexPhonebookAccess1 *proxy,
-    const gchar *arg_field,
-    const gchar *arg_value,
-    GVariant *arg_filters,
-    GCancellable *cancellable,
-    GAsyncReadyCallback callback,
-    gpointer user_data)
-{
-  g_dbus_proxy_call (G_DBUS_PROXY (proxy),
-    "Search",
-    g_variant_new ("(ss@a{sv})",
-                   arg_field,
-                   arg_value,
-                   arg_filters),
-    G_DBUS_CALL_FLAGS_NONE,
-    -1,
-    cancellable,
-    callback,
-    user_data);
-}
-
-/**
- * org_bluez_obex_phonebook_access1_call_search_finish:
- * @proxy: A #OrgBluezObexPhonebookAccess1Proxy.
- * @out_vcard_listing: (out): Return location for return parameter or %NULL to ignore.
- * @res: The #GAsyncResult obtained from the #GAsyncReadyCallback passed to org_bluez_obex_phonebook_access1_call_search().
- * @error: Return location for error or %NULL.
- *
- * Finishes an operation started with org_bluez_obex_phonebook_access1_call_search().
- *
- * Returns: (skip): %TRUE if the call succeded, %FALSE if @error is set.
- */
-gboolean
-org_bluez_obex_phonebook_access1_call_search_finish (
-    OrgBluezObexPhonebookAccess1 *proxy,
-    GVariant **out_vcard_listing,
-    GAsyncResult *res,
-    GError **error)
-{
-  GVariant *_ret;
-  _ret = g_dbus_proxy_call_finish (G_DBUS_PROXY (proxy), res, error);
-  if (_ret == NULL)
-    goto _out;
-  g_variant_get (_ret,
-                 "(@a(ss))",
-                 out_vcard_listing);
-  g_variant_unref (_ret);
-_out:
-  return _ret != NULL;
-}
-
-/**
- * org_bluez_obex_phonebook_access1_call_search_sync:
- * @proxy: A #OrgBluezObexPhonebookAccess1Proxy.
- * @arg_field: Argument to pass with the method invocation.
- * @arg_value: Argument to pass with the method invocation.
- * @arg_filters: Argument to pass with the method invocation.
- * @out_vcard_listing: (out): Return location for return parameter or %NULL to ignore.
- * @cancellable: (nullable): A #GCancellable or %NULL.
- * @error: Return location for error or %NULL.
- *
- * Synchronously invokes the <link linkend="gdbus-method-org-bluez-obex-PhonebookAccess1.Search">Search()</link> D-Bus method on @proxy. The calling thread is blocked until a reply is received.
- *
- * See org_bluez_obex_phonebook_access1_call_search() for the asynchronous version of this method.
- *
- * Returns: (skip): %TRUE if the call succeded, %FALSE if @error is set.
- */
-gboolean
-org_bluez_obex_phonebook_access1_call_search_sync (
-    OrgBluezObexPhonebookAccess1 *proxy,
-    const gchar *arg_field,
-    const gchar *arg_value,
-    GVariant *arg_filters,
-    GVariant **out_vcard_listing,
-    GCancellable *cancellable,
-    GError **error)
-{
-  GVariant *_ret;
-  _ret = g_dbus_proxy_call_sync (G_DBUS_PROXY (proxy),
-    "Search",
-    g_variant_new ("(ss@a{sv})",
-                   arg_field,
-                   arg_value,
-                   arg_filters),
-    G_DBUS_CALL_FLAGS_NONE,
-    -1,
-    cancellable,
-    error);
-  if (_ret == NULL)
-    goto _out;
-  g_variant_get (_ret,
-                 "(@a(ss))",
-                 out_vcard_listing);
-  g_variant_unref (_ret);
-_out:
-  return _ret != NULL;
-}
-
-/**
- * org_bluez_obex_phonebook_access1_call_get_size:
- * @proxy: A #OrgBluezObexPhonebookAccess1Proxy.
- * @cancellable: (nullable): A #GCancellable or %NULL.
- * @callback: A #GAsyncReadyCallback to call when the request is satisfied or %NULL.
- * @user_data: User data to pass to @callback.
- *
- * Asynchronously invokes the <link linkend="gdbus-method-org-bluez-obex-PhonebookAccess1.GetSize">GetSize()</link> D-Bus method on @proxy.
- * When the operation is finished, @callback will be invoked in the <link linkend="g-main-context-push-thread-default">thread-default main loop</link> of the thread you are calling this method from.
- * You can then call org_bluez_obex_phonebook_access1_call_get_size_finish() to get the result of the operation.
- *
- * See org_bluez_obex_phonebook_access1_call_get_size_sync() for the synchronous, blocking version of this method.
- */
-void
-org_bluez_obex_phonebook_access1_call_get_size (
-    OrgBluezObexPhonebookAccess1 *proxy,
-    GCancellable *cancellable,
-    GAsyncReadyCallback callback,
-    gpointer user_data)
-{
-  g_dbus_proxy_call (G_DBUS_PROXY (proxy),
-    "GetSize",
-    g_variant_new ("()"),
-    G_DBUS_CALL_FLAGS_NONE,
-    -1,
-    cancellable,
-    callback,
-    user_data);
-}
-
-/**
- * org_bluez_obex_phonebook_access1_call_get_size_finish:
- * @proxy: A #OrgBluezObexPhonebookAccess1Proxy.
- * @out_size: (out): Return location for return parameter or %NULL to ignore.
- * @res: The #GAsyncResult obtained from the #GAsyncReadyCallback passed to org_bluez_obex_phonebook_access1_call_get_size().
- * @error: Return location for error or %NULL.
- *
- * Finishes an operation started with org_bluez_obex_phonebook_access1_call_get_size().
- *
- * Returns: (skip): %TRUE if the call succeded, %FALSE if @error is set.
- */
-gboolean
-org_bluez_obex_phonebook_access1_call_get_size_finish (
-    OrgBluezObexPhonebookAccess1 *proxy,
-    guint16 *out_size,
-    GAsyncResult *res,
-    GError **error)
-{
-  GVariant *_ret;
-  _ret = g_dbus_proxy_call_finish (G_DBUS_PROXY (proxy), res, error);
-  if (_ret == NULL)
-    goto _out;
-  g_variant_get (_ret,
-                 "(q)",
-                 out_size);
-  g_variant_unref (_ret);
-_out:
-  return _ret != NULL;
-}
-
-/**
- * org_bluez_obex_phonebook_access1_call_get_size_sync:
- * @proxy: A #OrgBluezObexPhonebookAccess1Proxy.
- * @out_size: (out): Return location for return parameter or %NULL to ignore.
- * @cancellable: (nullable): A #GCancellable or %NULL.
- * @error: Return location for error or %NULL.
- *
- * Synchronously invokes the <link linkend="gdbus-method-org-bluez-obex-PhonebookAccess1.GetSize">GetSize()</link> D-Bus method on @proxy. The calling thread is blocked until a reply is received.
- *
- * See org_bluez_obex_phonebook_access1_call_get_size() for the asynchronous version of this method.
- *
- * Returns: (skip): %TRUE if the call succeded, %FALSE if @error is set.
- */
-gboolean
-org_bluez_obex_phonebook_access1_call_get_size_sync (
-    OrgBluezObexPhonebookAccess1 *proxy,
-    guint16 *out_size,
-    GCancellable *cancellable,
-    GError **error)
-{
-  GVariant *_ret;
-  _ret = g_dbus_proxy_call_sync (G_DBUS_PROXY (proxy),
-    "GetSize",
-    g_variant_new ("()"),
-    G_DBUS_CALL_FLAGS_NONE,
-    -1,
-    cancellable,
-    error);
-  if (_ret == NULL)
-    goto _out;
-  g_variant_get (_ret,
-                 "(q)",
-                 out_size);
-  g_variant_unref (_ret);
-_out:
-  return _ret != NULL;
-}
-
-/**
- * org_bluez_obex_phonebook_access1_call_list_filter_fields:
- * @proxy: A #OrgBluezObexPhonebookAccess1Proxy.
- * @cancellable: (nullable): A #GCancellable or %NULL.
- * @callback: A #GAsyncReadyCallback to call when the request is satisfied or %NULL.
- * @user_data: User data to pass to @callback.
- *
- * Asynchronously invokes the <link linkend="gdbus-method-org-bluez-obex-PhonebookAccess1.ListFilterFields">ListFilterFields()</link> D-Bus method on @proxy.
- * When the operation is finished, @callback will be invoked in the <link linkend="g-main-context-push-thread-default">thread-default main loop</link> of the thread you are calling this method from.
- * You can then call org_bluez_obex_phonebook_access1_call_list_filter_fields_finish() to get the result of the operation.
- *
- * See org_bluez_obex_phonebook_access1_call_list_filter_fields_sync() for the synchronous, blocking version of this method.
- */
-void
-org_bluez_obex_phonebook_access1_call_list_filter_fields (
-    OrgBluezObexPhonebookAccess1 *proxy,
-    GCancellable *cancellable,
-    GAsyncReadyCallback callback,
-    gpointer user_data)
-{
-  g_dbus_proxy_call (G_DBUS_PROXY (proxy),
-    "ListFilterFields",
-    g_variant_new ("()"),
-    G_DBUS_CALL_FLAGS_NONE,
-    -1,
-    cancellable,
-    callback,
-    user_data);
-}
-
-/**
- * org_bluez_obex_phonebook_access1_call_list_filter_fields_finish:
- * @proxy: A #OrgBluezObexPhonebookAccess1Proxy.
- * @out_fields: (out) (array zero-terminated=1): Return location for return parameter or %NULL to ignore.
- * @res: The #GAsyncResult obtained from the #GAsyncReadyCallback passed to org_bluez_obex_phonebook_access1_call_list_filter_fields().
- * @error: Return location for error or %NULL.
- *
- * Finishes an operation started with org_bluez_obex_phonebook_access1_call_list_filter_fields().
- *
- * Returns: (skip): %TRUE if the call succeded, %FALSE if @error is set.
- */
-gboolean
-org_bluez_obex_phonebook_access1_call_list_filter_fields_finish (
-    OrgBluezObexPhonebookAccess1 *proxy,
-    gchar ***out_fields,
-    GAsyncResult *res,
-    GError **error)
-{
-  GVariant *_ret;
-  _ret = g_dbus_proxy_call_finish (G_DBUS_PROXY (proxy), res, error);
-  if (_ret == NULL)
-    goto _out;
-  g_variant_get (_ret,
-                 "(^as)",
-                 out_fields);
-  g_variant_unref (_ret);
-_out:
-  return _ret != NULL;
-}
-
-/**
- * org_bluez_obex_phonebook_access1_call_list_filter_fields_sync:
- * @proxy: A #OrgBluezObexPhonebookAccess1Proxy.
- * @out_fields: (out) (array zero-terminated=1): Return location for return parameter or %NULL to ignore.
- * @cancellable: (nullable): A #GCancellable or %NULL.
- * @error: Return location for error or %NULL.
- *
- * Synchronously invokes the <link linkend="gdbus-method-org-bluez-obex-PhonebookAccess1.ListFilterFields">ListFilterFields()</link> D-Bus method on @proxy. The calling thread is blocked until a reply is received.
- *
- * See org_bluez_obex_phonebook_access1_call_list_filter_fields() for the asynchronous version of this method.
- *
- * Returns: (skip): %TRUE if the call succeded, %FALSE if @error is set.
- */
-gboolean
-org_bluez_obex_phonebook_access1_call_list_filter_fields_sync (
-    OrgBluezObexPhonebookAccess1 *proxy,
-    gchar ***out_fields,
-    GCancellable *cancellable,
-    GError **error)
-{
-  GVariant *_ret;
-  _ret = g_dbus_proxy_call_sync (G_DBUS_PROXY (proxy),
-    "ListFilterFields",
-    g_variant_new ("()"),
-    G_DBUS_CALL_FLAGS_NONE,
-    -1,
-    cancellable,
-    error);
-  if (_ret == NULL)
-    goto _out;
-  g_variant_get (_ret,
-                 "(^as)",
-                 out_fields);
-  g_variant_unref (_ret);
-_out:
-  return _ret != NULL;
-}
-
-/**
- * org_bluez_obex_phonebook_access1_call_update_version:
- * @proxy: A #OrgBluezObexPhonebookAccess1Proxy.
- * @cancellable: (nullable): A #GCancellable or %NULL.
- * @callback: A #GAsyncReadyCallback to call when the request is satisfied or %NULL.
- * @user_data: User data to pass to @callback.
- *
- * Asynchronously invokes the <link linkend="gdbus-method-org-bluez-obex-PhonebookAccess1.UpdateVersion">UpdateVersion()</link> D-Bus method on @proxy.
- * When the operation is finished, @callback will be invoked in the <link linkend="g-main-context-push-thread-default">thread-default main loop</link> of the thread you are calling this method from.
- * You can then call org_bluez_obex_phonebook_access1_call_update_version_finish() to get the result of the operation.
- *
- * See org_bluez_obex_phonebook_access1_call_update_version_sync() for the synchronous, blocking version of this method.
- */
-void
-org_bluez_obex_phonebook_access1_call_update_version (
-    OrgBluezObexPhonebookAccess1 *proxy,
-    GCancellable *cancellable,
-    GAsyncReadyCallback callback,
-    gpointer user_data)
-{
-  g_dbus_proxy_call (G_DBUS_PROXY (proxy),
-    "UpdateVersion",
-    g_variant_new ("()"),
-    G_DBUS_CALL_FLAGS_NONE,
-    -1,
-    cancellable,
-    callback,
-    user_data);
-}
-
-/**
- * org_bluez_obex_phonebook_access1_call_update_version_finish:
- * @proxy: A #OrgBluezObexPhonebookAccess1Proxy.
- * @res: The #GAsyncResult obtained from the #GAsyncReadyCallback passed to org_bluez_obex_phonebook_access1_call_update_version().
- * @error: Return location for error or %NULL.
- *
- * Finishes an operation started with org_bluez_obex_phonebook_access1_call_update_version().
- *
- * Returns: (skip): %TRUE if the call succeded, %FALSE if @error is set.
- */
-gboolean
-org_bluez_obex_phonebook_access1_call_update_version_finish (
-    OrgBluezObexPhonebookAccess1 *proxy,
-    GAsyncResult *res,
-    GError **error)
-{
-  GVariant *_ret;
-  _ret = g_dbus_proxy_call_finish (G_DBUS_PROXY (proxy), res, error);
-  if (_ret == NULL)
-    goto _out;
-  g_variant_get (_ret,
-                 "()");
-  g_variant_unref (_ret);
-_out:
-  return _ret != NULL;
-}
-
-/**
- * org_bluez_obex_phonebook_access1_call_update_version_sync:
- * @proxy: A #OrgBluezObexPhonebookAccess1Proxy.
- * @cancellable: (nullable): A #GCancellable or %NULL.
- * @error: Return location for error or %NULL.
- *
- * Synchronously invokes the <link linkend="gdbus-method-org-bluez-obex-PhonebookAccess1.UpdateVersion">UpdateVersion()</link> D-Bus method on @proxy. The calling thread is blocked until a reply is received.
- *
- * See org_bluez_obex_phonebook_access1_call_update_version() for the asynchronous version of this method.
- *
- * Returns: (skip): %TRUE if the call succeded, %FALSE if @error is set.
- */
-gboolean
-org_bluez_obex_phonebook_access1_call_update_version_sync (
-    OrgBluezObexPhonebookAccess1 *proxy,
-    GCancellable *cancellable,
-    GError **error)
-{
-  GVariant *_ret;
-  _ret = g_dbus_proxy_call_sync (G_DBUS_PROXY (proxy),
-    "UpdateVersion",
-    g_variant_new ("()"),
-    G_DBUS_CALL_FLAGS_NONE,
-    -1,
-    cancellable,
-    error);
-  if (_ret == NULL)
-    goto _out;
-  g_variant_get (_ret,
-                 "()");
-  g_variant_unref (_ret);
-_out:
-  return _ret != NULL;
-}
-
-/**
- * org_bluez_obex_phonebook_access1_complete_select:
- * @object: A #OrgBluezObexPhonebookAccess1.
- * @invocation: (transfer full): A #GDBusMethodInvocation.
- *
- * Helper function used in service implementations to finish handling invocations of the <link linkend="gdbus-method-org-bluez-obex-PhonebookAccess1.Select">Select()</link> D-Bus method. If you instead want to finish handling an invocation by returning an error, use g_dbus_method_invocation_return_error() or similar.
- *
- * This method will free @invocation, you cannot use it afterwards.
- */
-void
-org_bluez_obex_phonebook_access1_complete_select (
-    OrgBluezObexPhonebookAccess1 *object,
-    GDBusMethodInvocation *invocation)
-{
-  g_dbus_method_invocation_return_value (invocation,
-    g_variant_new ("()"));
-}
-
-/**
- * org_bluez_obex_phonebook_access1_complete_pull_all:
- * @object: A #OrgBluezObexPhonebookAccess1.
- * @invocation: (transfer full): A #GDBusMethodInvocation.
- * @transfer: Parameter to return.
- * @properties: Parameter to return.
- *
- * Helper function used in service implementations to finish handling invocations of the <link linkend="gdbus-method-org-bluez-obex-PhonebookAccess1.PullAll">PullAll()</link> D-Bus method. If you instead want to finish handling an invocation by returning an error, use g_dbus_method_invocation_return_error() or similar.
- *
- * This method will free @invocation, you cannot use it afterwards.
- */
-void
-org_bluez_obex_phonebook_access1_complete_pull_all (
-    OrgBluezObexPhonebookAccess1 *object,
-    GDBusMethodInvocation *invocation,
-    const gchar *transfer,
-    GVariant *properties)
-{
-  g_dbus_method_invocation_return_value (invocation,
-    g_variant_new ("(o@a{sv})",
-                   transfer,
-                   properties));
-}
-
-/**
- * org_bluez_obex_phonebook_access1_complete_pull:
- * @object: A #OrgBluezObexPhonebookAccess1.
- * @invocation: (transfer full): A #GDBusMethodInvocation.
- * @transfer: Parameter to return.
- * @properties: Parameter to return.
- *
- * Helper function used in service implementations to finish handling invocations of the <link linkend="gdbus-method-org-bluez-obex-PhonebookAccess1.Pull">Pull()</link> D-Bus method. If you instead want to finish handling an invocation by returning an error, use g_dbus_method_invocation_return_error() or similar.
- *
- * This method will free @invocation, you cannot use it afterwards.
- */
-void
-org_bluez_obex_phonebook_access1_complete_pull (
-    OrgBluezObexPhonebookAccess1 *object,
-    GDBusMethodInvocation *invocation,
-    const gchar *transfer,
-    GVariant *properties)
-{
-  g_dbus_method_invocation_return_value (invocation,
-    g_variant_new ("(o@a{sv})",
-                   transfer,
-                   properties));
-}
-
-/**
- * org_bluez_obex_phonebook_access1_complete_list:
- * @object: A #OrgBluezObexPhonebookAccess1.
- * @invocation: (transfer full): A #GDBusMethodInvocation.
- * @vcard_listing: Parameter to return.
- *
- * Helper function used in service implementations to finish handling invocations of the <link linkend="gdbus-method-org-bluez-obex-PhonebookAccess1.List">List()</link> D-Bus method. If you instead want to finish handling an invocation by returning an error, use g_dbus_method_invocation_return_error() or similar.
- *
- * This method will free @invocation, you cannot use it afterwards.
- */
-void
-org_bluez_obex_phonebook_access1_complete_list (
-    OrgBluezObexPhonebookAccess1 *object,
-    GDBusMethodInvocation *invocation,
-    GVariant *vcard_listing)
-{
-  g_dbus_method_invocation_return_value (invocation,
-    g_variant_new ("(@a(ss))",
-                   vcard_listing));
-}
-
-/**
- * org_bluez_obex_phonebook_access1_complete_search:
- * @object: A #OrgBluezObexPhonebookAccess1.
- * @invocation: (transfer full): A #GDBusMethodInvocation.
- * @vcard_listing: Parameter to return.
- *
- * Helper function used in service implementations to finish handling invocations of the <link linkend="gdbus-method-org-bluez-obex-PhonebookAccess1.Search">Search()</link> D-Bus method. If you instead want to finish handling an invocation by returning an error, use g_dbus_method_invocation_return_error() or similar.
- *
- * This method will free @invocation, you cannot use it afterwards.
- */
-void
-org_bluez_obex_phonebook_access1_complete_search (
-    OrgBluezObexPhonebookAccess1 *object,
-    GDBusMethodInvocation *invocation,
-    GVariant *vcard_listing)
-{
-  g_dbus_method_invocation_return_value (invocation,
-    g_variant_new ("(@a(ss))",
-                   vcard_listing));
-}
-
-/**
- * org_bluez_obex_phonebook_access1_complete_get_size:
- * @object: A #OrgBluezObexPhonebookAccess1.
- * @invocation: (transfer full): A #GDBusMethodInvocation.
- * @size: Parameter to return.
- *
- * Helper function used in service implementations to finish handling invocations of the <link linkend="gdbus-method-org-bluez-obex-PhonebookAccess1.GetSize">GetSize()</link> D-Bus method. If you instead want to finish handling an invocation by returning an error, use g_dbus_method_invocation_return_error() or similar.
- *
- * This method will free @invocation, you cannot use it afterwards.
- */
-void
-org_bluez_obex_phonebook_access1_complete_get_size (
-    OrgBluezObexPhonebookAccess1 *object,
-    GDBusMethodInvocation *invocation,
-    guint16 size)
-{
-  g_dbus_method_invocation_return_value (invocation,
-    g_variant_new ("(q)",
-                   size));
-}
-
-/**
- * org_bluez_obex_phonebook_access1_complete_list_filter_fields:
- * @object: A #OrgBluezObexPhonebookAccess1.
- * @invocation: (transfer full): A #GDBusMethodInvocation.
- * @fields: Parameter to return.
- *
- * Helper function used in service implementations to finish handling invocations of the <link linkend="gdbus-method-org-bluez-obex-PhonebookAccess1.ListFilterFields">ListFilterFields()</link> D-Bus method. If you instead want to finish handling an invocation by returning an error, use g_dbus_method_invocation_return_error() or similar.
- *
- * This method will free @invocation, you cannot use it afterwards.
- */
-void
-org_bluez_obex_phonebook_access1_complete_list_filter_fields (
-    OrgBluezObexPhonebookAccess1 *object,
-    GDBusMethodInvocation *invocation,
-    const gchar *const *fields)
-{
-  g_dbus_method_invocation_return_value (invocation,
-    g_variant_new ("(^as)",
-                   fields));
-}
-
-/**
- * org_bluez_obex_phonebook_access1_complete_update_version:
- * @object: A #OrgBluezObexPhonebookAccess1.
- * @invocation: (transfer full): A #GDBusMethodInvocation.
- *
- * Helper function used in service implementations to finish handling invocations of the <link linkend="gdbus-method-org-bluez-obex-PhonebookAccess1.UpdateVersion">UpdateVersion()</link> D-Bus method. If you instead want to finish handling an invocation by returning an error, use g_dbus_method_invocation_return_error() or similar.
- *
- * This method will free @invocation, you cannot use it afterwards.
- */
-void
-org_bluez_obex_phonebook_access1_complete_update_version (
-    OrgBluezObexPhonebookAccess1 *object,
-    GDBusMethodInvocation *invocation)
-{
-  g_dbus_method_invocation_return_value (invocation,
-    g_variant_new ("()"));
-}
-
-/* ------------------------------------------------------------------------ */
-
-/**
- * OrgBluezObexPhonebookAccess1Proxy:
- *
- * The #OrgBluezObexPhonebookAccess1Proxy structure contains only private data and should only be accessed using the provided API.
- */
-
-/**
- * OrgBluezObexPhonebookAccess1ProxyClass:
- * @parent_class: The parent class.
- *
- * Class structure for #OrgBluezObexPhonebookAccess1Proxy.
- */
-
-struct _OrgBluezObexPhonebookAccess1ProxyPrivate
-{
-  GData *qdata;
-};
-
-static void org_bluez_obex_phonebook_access1_proxy_iface_init (OrgBluezObexPhonebookAccess1Iface *iface);
-
-#if GLIB_VERSION_MAX_ALLOWED >= GLIB_VERSION_2_38
-G_DEFINE_TYPE_WITH_CODE (OrgBluezObexPhonebookAccess1Proxy, org_bluez_obex_phonebook_access1_proxy, G_TYPE_DBUS_PROXY,
-                         G_ADD_PRIVATE (OrgBluezObexPhonebookAccess1Proxy)
-                         G_IMPLEMENT_INTERFACE (TYPE_ORG_BLUEZ_OBEX_PHONEBOOK_ACCESS1, org_bluez_obex_phonebook_access1_proxy_iface_init))
-
-#else
-G_DEFINE_TYPE_WITH_CODE (OrgBluezObexPhonebookAccess1Proxy, org_bluez_obex_phonebook_access1_proxy, G_TYPE_DBUS_PROXY,
-                         G_IMPLEMENT_INTERFACE (TYPE_ORG_BLUEZ_OBEX_PHONEBOOK_ACCESS1, org_bluez_obex_phonebook_access1_proxy_iface_init))
-
-#endif
-static void
-org_bluez_obex_phonebook_access1_proxy_finalize (GObject *object)
-{
-  OrgBluezObexPhonebookAccess1Proxy *proxy = ORG_BLUEZ_OBEX_PHONEBOOK_ACCESS1_PROXY (object);
-  g_datalist_clear (&proxy->priv->qdata);
-  G_OBJECT_CLASS (org_bluez_obex_phonebook_access1_proxy_parent_class)->finalize (object);
-}
-
-static void
-org_bluez_obex_phonebook_access1_proxy_get_property (GObject      *object,
-  guint         prop_id,
-  GValue       *value,
-  GParamSpec   *pspec G_GNUC_UNUSED)
-{
-  const _ExtendedGDBusPropertyInfo *info;
-  GVariant *variant;
-  g_assert (prop_id != 0 && prop_id - 1 < 5);
-  info = _org_bluez_obex_phonebook_access1_property_info_pointers[prop_id - 1];
-  variant = g_dbus_proxy_get_cached_property (G_DBUS_PROXY (object), info->parent_struct.name);
-  if (info->use_gvariant)
-    {
-      g_value_set_variant (value, variant);
-    }
-  else
-    {
-      if (variant != NULL)
-        g_dbus_gvariant_to_gvalue (variant, value);
-    }
-  if (variant != NULL)
-    g_variant_unref (variant);
-}
-
-static void
-org_bluez_obex_phonebook_access1_proxy_set_property_cb (GDBusProxy *proxy,
-  GAsyncResult *res,
-  gpointer      user_data)
-{
-  const _ExtendedGDBusPropertyInfo *info = user_data;
-  GError *error;
-  GVariant *_ret;
-  error = NULL;
-  _ret = g_dbus_proxy_call_finish (proxy, res, &error);
-  if (!_ret)
-    {
-      g_warning ("Error setting property '%s' on interface org.bluez.obex.PhonebookAccess1: %s (%s, %d)",
-                 info->parent_struct.name, 
-                 error->message, g_quark_to_string (error->domain), error->code);
-      g_error_free (error);
-    }
-  else
-    {
-      g_variant_unref (_ret);
-    }
-}
-
-static void
-org_bluez_obex_phonebook_access1_proxy_set_property (GObject      *object,
-  guint         prop_id,
-  const GValue *value,
-  GParamSpec   *pspec G_GNUC_UNUSED)
-{
-  const _ExtendedGDBusPropertyInfo *info;
-  GVariant *variant;
-  g_assert (prop_id != 0 && prop_id - 1 < 5);
-  info = _org_bluez_obex_phonebook_access1_property_info_pointers[prop_id - 1];
-  variant = g_dbus_gvalue_to_gvariant (value, G_VARIANT_TYPE (info->parent_struct.signature));
-  g_dbus_proxy_call (G_DBUS_PROXY (object),
-    "org.freedesktop.DBus.Properties.Set",
-    g_variant_new ("(ssv)", "org.bluez.obex.PhonebookAccess1", info->parent_struct.name, variant),
-    G_DBUS_CALL_FLAGS_NONE,
-    -1,
-    NULL, (GAsyncReadyCallback) org_bluez_obex_phonebook_access1_proxy_set_property_cb, (GDBusPropertyInfo *) &info->parent_struct);
-  g_variant_unref (variant);
-}
-
-static void
-org_bluez_obex_phonebook_access1_proxy_g_signal (GDBusProxy *proxy,
-  const gchar *sender_name G_GNUC_UNUSED,
-  const gchar *signal_name,
-  GVariant *parameters)
-{
-  _ExtendedGDBusSignalInfo *info;
-  GVariantIter iter;
-  GVariant *child;
-  GValue *paramv;
-  gsize num_params;
-  gsize n;
-  guint signal_id;
-  info = (_ExtendedGDBusSignalInfo *) g_dbus_interface_info_lookup_signal ((GDBusInterfaceInfo *) &_org_bluez_obex_phonebook_access1_interface_info.parent_struct, signal_name);
-  if (info == NULL)
-    return;
-  num_params = g_variant_n_children (parameters);
-  paramv = g_new0 (GValue, num_params + 1);
-  g_value_init (&paramv[0], TYPE_ORG_BLUEZ_OBEX_PHONEBOOK_ACCESS1);
-  g_value_set_object (&paramv[0], proxy);
-  g_variant_iter_init (&iter, parameters);
-  n = 1;
-  while ((child = g_variant_iter_next_value (&iter)) != NULL)
-    {
-      _ExtendedGDBusArgInfo *arg_info = (_ExtendedGDBusArgInfo *) info->parent_struct.args[n - 1];
-      if (arg_info->use_gvariant)
-        {
-          g_value_init (&paramv[n], G_TYPE_VARIANT);
-          g_value_set_variant (&paramv[n], child);
-          n++;
-        }
-      else
-        g_dbus_gvariant_to_gvalue (child, &paramv[n++]);
-      g_variant_unref (child);
-    }
-  signal_id = g_signal_lookup (info->signal_name, TYPE_ORG_BLUEZ_OBEX_PHONEBOOK_ACCESS1);
-  g_signal_emitv (paramv, signal_id, 0, NULL);
-  for (n = 0; n < num_params + 1; n++)
-    g_value_unset (&paramv[n]);
-  g_free (paramv);
-}
-
-static void
-org_bluez_obex_phonebook_access1_proxy_g_properties_changed (GDBusProxy *_proxy,
-  GVariant *changed_properties,
-  const gchar *const *invalidated_properties)
-{
-  OrgBluezObexPhonebookAccess1Proxy *proxy = ORG_BLUEZ_OBEX_PHONEBOOK_ACCESS1_PROXY (_proxy);
-  guint n;
-  const gchar *key;
-  GVariantIter *iter;
-  _ExtendedGDBusPropertyInfo *info;
-  g_variant_get (changed_properties, "a{sv}", &iter);
-  while (g_variant_iter_next (iter, "{&sv}", &key, NULL))
-    {
-      info = (_ExtendedGDBusPropertyInfo *) g_dbus_interface_info_lookup_property ((GDBusInterfaceInfo *) &_org_bluez_obex_phonebook_access1_interface_info.parent_struct, key);
-      g_datalist_remove_data (&proxy->priv->qdata, key);
-      if (info != NULL)
-        g_object_notify (G_OBJECT (proxy), info->hyphen_name);
-    }
-  g_variant_iter_free (iter);
-  for (n = 0; invalidated_properties[n] != NULL; n++)
-    {
-      info = (_ExtendedGDBusPropertyInfo *) g_dbus_interface_info_lookup_property ((GDBusInterfaceInfo *) &_org_bluez_obex_phonebook_access1_interface_info.parent_struct, invalidated_properties[n]);
-      g_datalist_remove_data (&proxy->priv->qdata, invalidated_properties[n]);
-      if (info != NULL)
-        g_object_notify (G_OBJECT (proxy), info->hyphen_name);
-    }
-}
-
-static const gchar *
-org_bluez_obex_phonebook_access1_proxy_get_folder (OrgBluezObexPhonebookAccess1 *object)
-{
-  OrgBluezObexPhonebookAccess1Proxy *proxy = ORG_BLUEZ_OBEX_PHONEBOOK_ACCESS1_PROXY (object);
-  GVariant *variant;
-  const gchar *value = NULL;
-  variant = g_dbus_proxy_get_cached_property (G_DBUS_PROXY (proxy), "Folder");
-  if (variant != NULL)
-    {
-      value = g_variant_get_string (variant, NULL);
-      g_variant_unref (variant);
-    }
-  return value;
-}
-
-static const gchar *
-org_bluez_obex_phonebook_access1_proxy_get_database_identifier (OrgBluezObexPhonebookAccess1 *object)
-{
-  OrgBluezObexPhonebookAccess1Proxy *proxy = ORG_BLUEZ_OBEX_PHONEBOOK_ACCESS1_PROXY (object);
-  GVariant *variant;
-  const gchar *value = NULL;
-  variant = g_dbus_proxy_get_cached_property (G_DBUS_PROXY (proxy), "DatabaseIdentifier");
-  if (variant != NULL)
-    {
-      value = g_variant_get_string (variant, NULL);
-      g_variant_unref (variant);
-    }
-  return value;
-}
-
-static const gchar *
-org_bluez_obex_phonebook_access1_proxy_get_primary_counter (OrgBluezObexPhonebookAccess1 *object)
-{
-  OrgBluezObexPhonebookAccess1Proxy *proxy = ORG_BLUEZ_OBEX_PHONEBOOK_ACCESS1_PROXY (object);
-  GVariant *variant;
-  const gchar *value = NULL;
-  variant = g_dbus_proxy_get_cached_property (G_DBUS_PROXY (proxy), "PrimaryCounter");
-  if (variant != NULL)
-    {
-      value = g_variant_get_string (variant, NULL);
-      g_variant_unref (variant);
-    }
-  return value;
-}
-
-static const gchar *
-org_bluez_obex_phonebook_access1_proxy_get_secondary_counter (OrgBluezObexPhonebookAccess1 *object)
-{
-  OrgBluezObexPhonebookAccess1Proxy *proxy = ORG_BLUEZ_OBEX_PHONEBOOK_ACCESS1_PROXY (object);
-  GVariant *variant;
-  const gchar *value = NULL;
-  variant = g_dbus_proxy_get_cached_property (G_DBUS_PROXY (proxy), "SecondaryCounter");
-  if (variant != NULL)
-    {
-      value = g_variant_get_string (variant, NULL);
-      g_variant_unref (variant);
-    }
-  return value;
-}
-
-static gboolean 
-org_bluez_obex_phonebook_access1_proxy_get_fixed_image_size (OrgBluezObexPhonebookAccess1 *object)
-{
-  OrgBluezObexPhonebookAccess1Proxy *proxy = ORG_BLUEZ_OBEX_PHONEBOOK_ACCESS1_PROXY (object);
-  GVariant *variant;
-  gboolean value = 0;
-  variant = g_dbus_proxy_get_cached_property (G_DBUS_PROXY (proxy), "FixedImageSize");
-  if (variant != NULL)
-    {
-      value = g_variant_get_boolean (variant);
-      g_variant_unref (variant);
-    }
-  return value;
-}
-
-static void
-org_bluez_obex_phonebook_access1_proxy_init (OrgBluezObexPhonebookAccess1Proxy *proxy)
-{
-#if GLIB_VERSION_MAX_ALLOWED >= GLIB_VERSION_2_38
-  proxy->priv = org_bluez_obex_phonebook_access1_proxy_get_instance_private (proxy);
-#else
-  proxy->priv = G_TYPE_INSTANCE_GET_PRIVATE (proxy, TYPE_ORG_BLUEZ_OBEX_PHONEBOOK_ACCESS1_PROXY, OrgBluezObexPhonebookAccess1ProxyPrivate);
-#endif
-
-  g_dbus_proxy_set_interface_info (G_DBUS_PROXY (proxy), org_bluez_obex_phonebook_access1_interface_info ());
-}
-
-static void
-org_bluez_obex_phonebook_access1_proxy_class_init (OrgBluezObexPhonebookAccess1ProxyClass *klass)
-{
-  GObjectClass *gobject_class;
-  GDBusProxyClass *proxy_class;
-
-  gobject_class = G_OBJECT_CLASS (klass);
-  gobject_class->finalize     = org_bluez_obex_phonebook_access1_proxy_finalize;
-  gobject_class->get_property = org_bluez_obex_phonebook_access1_proxy_get_property;
-  gobject_class->set_property = org_bluez_obex_phonebook_access1_proxy_set_property;
-
-  proxy_class = G_DBUS_PROXY_CLASS (klass);
-  proxy_class->g_signal = org_bluez_obex_phonebook_access1_proxy_g_signal;
-  proxy_class->g_properties_changed = org_bluez_obex_phonebook_access1_proxy_g_properties_changed;
-
-  org_bluez_obex_phonebook_access1_override_properties (gobject_class, 1);
-
-#if GLIB_VERSION_MAX_ALLOWED < GLIB_VERSION_2_38
-  g_type_class_add_private (klass, sizeof (OrgBluezObexPhonebookAccess1ProxyPrivate));
-#endif
-}
-
-static void
-org_bluez_obex_phonebook_access1_proxy_iface_init (OrgBluezObexPhonebookAccess1Iface *iface)
-{
-  iface->get_folder = org_bluez_obex_phonebook_access1_proxy_get_folder;
-  iface->get_database_identifier = org_bluez_obex_phonebook_access1_proxy_get_database_identifier;
-  iface->get_primary_counter = org_bluez_obex_phonebook_access1_proxy_get_primary_counter;
-  iface->get_secondary_counter = org_bluez_obex_phonebook_access1_proxy_get_secondary_counter;
-  iface->get_fixed_image_size = org_bluez_obex_phonebook_access1_proxy_get_fixed_image_size;
-}
-
-/**
- * org_bluez_obex_phonebook_access1_proxy_new:
- * @connection: A #GDBusConnection.
- * @flags: Flags from the #GDBusProxyFlags enumeration.
- * @name: (nullable): A bus name (well-known or unique) or %NULL if @connection is not a message bus connection.
- * @object_path: An object path.
- * @cancellable: (nullable): A #GCancellable or %NULL.
- * @callback: A #GAsyncReadyCallback to call when the request is satisfied.
- * @user_data: User data to pass to @callback.
- *
- * Asynchronously creates a proxy for the D-Bus interface <link linkend="gdbus-interface-org-bluez-obex-PhonebookAccess1.top_of_page">org.bluez.obex.PhonebookAccess1</link>. See g_dbus_proxy_new() for more details.
- *
- * When the operation is finished, @callback will be invoked in the <link linkend="g-main-context-push-thread-default">thread-default main loop</link> of the thread you are calling this method from.
- * You can then call org_bluez_obex_phonebook_access1_proxy_new_finish() to get the result of the operation.
- *
- * See org_bluez_obex_phonebook_access1_proxy_new_sync() for the synchronous, blocking version of this constructor.
- */
-void
-org_bluez_obex_phonebook_access1_proxy_new (
-    GDBusConnection     *connection,
-    GDBusProxyFlags      flags,
-    const gchar         *name,
-    const gchar         *object_path,
-    GCancellable        *cancellable,
-    GAsyncReadyCallback  callback,
-    gpointer             user_data)
-{
-  g_async_initable_new_async (TYPE_ORG_BLUEZ_OBEX_PHONEBOOK_ACCESS1_PROXY, G_PRIORITY_DEFAULT, cancellable, callback, user_data, "g-flags", flags, "g-name", name, "g-connection", connection, "g-object-path", object_path, "g-interface-name", "org.bluez.obex.PhonebookAccess1", NULL);
-}
-
-/**
- * org_bluez_obex_phonebook_access1_proxy_new_finish:
- * @res: The #GAsyncResult obtained from the #GAsyncReadyCallback passed to org_bluez_obex_phonebook_access1_proxy_new().
- * @error: Return location for error or %NULL
- *
- * Finishes an operation started with org_bluez_obex_phonebook_access1_proxy_new().
- *
- * Returns: (transfer full) (type OrgBluezObexPhonebookAccess1Proxy): The constructed proxy object or %NULL if @error is set.
- */
-OrgBluezObexPhonebookAccess1 *
-org_bluez_obex_phonebook_access1_proxy_new_finish (
-    GAsyncResult        *res,
-    GError             **error)
-{
-  GObject *ret;
-  GObject *source_object;
-  source_object = g_async_result_get_source_object (res);
-  ret = g_async_initable_new_finish (G_ASYNC_INITABLE (source_object), res, error);
-  g_object_unref (source_object);
-  if (ret != NULL)
-    return ORG_BLUEZ_OBEX_PHONEBOOK_ACCESS1 (ret);
-  else
-    return NULL;
-}
-
-/**
- * org_bluez_obex_phonebook_access1_proxy_new_sync:
- * @connection: A #GDBusConnection.
- * @flags: Flags from the #GDBusProxyFlags enumeration.
- * @name: (nullable): A bus name (well-known or unique) or %NULL if @connection is not a message bus connection.
- * @object_path: An object path.
- * @cancellable: (nullable): A #GCancellable or %NULL.
- * @error: Return location for error or %NULL
- *
- * Synchronously creates a proxy for the D-Bus interface <link linkend="gdbus-interface-org-bluez-obex-PhonebookAccess1.top_of_page">org.bluez.obex.PhonebookAccess1</link>. See g_dbus_proxy_new_sync() for more details.
- *
- * The calling thread is blocked until a reply is received.
- *
- * See org_bluez_obex_phonebook_access1_proxy_new() for the asynchronous version of this constructor.
- *
- * Returns: (transfer full) (type OrgBluezObexPhonebookAccess1Proxy): The constructed proxy object or %NULL if @error is set.
- */
-OrgBluezObexPhonebookAccess1 *
-org_bluez_obex_phonebook_access1_proxy_new_sync (
-    GDBusConnection     *connection,
-    GDBusProxyFlags      flags,
-    const gchar         *name,
-    const gchar         *object_path,
-    GCancellable        *cancellable,
-    GError             **error)
-{
-  GInitable *ret;
-  ret = g_initable_new (TYPE_ORG_BLUEZ_OBEX_PHONEBOOK_ACCESS1_PROXY, cancellable, error, "g-flags", flags, "g-name", name, "g-connection", connection, "g-object-path", object_path, "g-interface-name", "org.bluez.obex.PhonebookAccess1", NULL);
-  if (ret != NULL)
-    return ORG_BLUEZ_OBEX_PHONEBOOK_ACCESS1 (ret);
-  else
-    return NULL;
-}
-
-
-/**
- * org_bluez_obex_phonebook_access1_proxy_new_for_bus:
- * @bus_type: A #GBusType.
- * @flags: Flags from the #GDBusProxyFlags enumeration.
- * @name: A bus name (well-known or unique).
- * @object_path: An object path.
- * @cancellable: (nullable): A #GCancellable or %NULL.
- * @callback: A #GAsyncReadyCallback to call when the request is satisfied.
- * @user_data: User data to pass to @callback.
- *
- * Like org_bluez_obex_phonebook_access1_proxy_new() but takes a #GBusType instead of a #GDBusConnection.
- *
- * When the operation is finished, @callback will be invoked in the <link linkend="g-main-context-push-thread-default">thread-default main loop</link> of the thread you are calling this method from.
- * You can then call org_bluez_obex_phonebook_access1_proxy_new_for_bus_finish() to get the result of the operation.
- *
- * See org_bluez_obex_phonebook_access1_proxy_new_for_bus_sync() for the synchronous, blocking version of this constructor.
- */
-void
-org_bluez_obex_phonebook_access1_proxy_new_for_bus (
-    GBusType             bus_type,
-    GDBusProxyFlags      flags,
-    const gchar         *name,
-    const gchar         *object_path,
-    GCancellable        *cancellable,
-    GAsyncReadyCallback  callback,
-    gpointer             user_data)
-{
-  g_async_initable_new_async (TYPE_ORG_BLUEZ_OBEX_PHONEBOOK_ACCESS1_PROXY, G_PRIORITY_DEFAULT, cancellable, callback, user_data, "g-flags", flags, "g-name", name, "g-bus-type", bus_type, "g-object-path", object_path, "g-interface-name", "org.bluez.obex.PhonebookAccess1", NULL);
-}
-
-/**
- * org_bluez_obex_phonebook_access1_proxy_new_for_bus_finish:
- * @res: The #GAsyncResult obtained from the #GAsyncReadyCallback passed to org_bluez_obex_phonebook_access1_proxy_new_for_bus().
- * @error: Return location for error or %NULL
- *
- * Finishes an operation started with org_bluez_obex_phonebook_access1_proxy_new_for_bus().
- *
- * Returns: (transfer full) (type OrgBluezObexPhonebookAccess1Proxy): The constructed proxy object or %NULL if @error is set.
- */
-OrgBluezObexPhonebookAccess1 *
-org_bluez_obex_phonebook_access1_proxy_new_for_bus_finish (
-    GAsyncResult        *res,
-    GError             **error)
-{
-  GObject *ret;
-  GObject *source_object;
-  source_object = g_async_result_get_source_object (res);
-  ret = g_async_initable_new_finish (G_ASYNC_INITABLE (source_object), res, error);
-  g_object_unref (source_object);
-  if (ret != NULL)
-    return ORG_BLUEZ_OBEX_PHONEBOOK_ACCESS1 (ret);
-  else
-    return NULL;
-}
-
-/**
- * org_bluez_obex_phonebook_access1_proxy_new_for_bus_sync:
- * @bus_type: A #GBusType.
- * @flags: Flags from the #GDBusProxyFlags enumeration.
- * @name: A bus name (well-known or unique).
- * @object_path: An object path.
- * @cancellable: (nullable): A #GCancellable or %NULL.
- * @error: Return location for error or %NULL
- *
- * Like org_bluez_obex_phonebook_access1_proxy_new_sync() but takes a #GBusType instead of a #GDBusConnection.
- *
- * The calling thread is blocked until a reply is received.
- *
- * See org_bluez_obex_phonebook_access1_proxy_new_for_bus() for the asynchronous version of this constructor.
- *
- * Returns: (transfer full) (type OrgBluezObexPhonebookAccess1Proxy): The constructed proxy object or %NULL if @error is set.
- */
-OrgBluezObexPhonebookAccess1 *
-org_bluez_obex_phonebook_access1_proxy_new_for_bus_sync (
-    GBusType             bus_type,
-    GDBusProxyFlags      flags,
-    const gchar         *name,
-    const gchar         *object_path,
-    GCancellable        *cancellable,
-    GError             **error)
-{
-  GInitable *ret;
-  ret = g_initable_new (TYPE_ORG_BLUEZ_OBEX_PHONEBOOK_ACCESS1_PROXY, cancellable, error, "g-flags", flags, "g-name", name, "g-bus-type", bus_type, "g-object-path", object_path, "g-interface-name", "org.bluez.obex.PhonebookAccess1", NULL);
-  if (ret != NULL)
-    return ORG_BLUEZ_OBEX_PHONEBOOK_ACCESS1 (ret);
-  else
-    return NULL;
-}
-
-
-/* ------------------------------------------------------------------------ */
-
-/**
- * OrgBluezObexPhonebookAccess1Skeleton:
- *
- * The #OrgBluezObexPhonebookAccess1Skeleton structure contains only private data and should only be accessed using the provided API.
- */
-
-/**
- * OrgBluezObexPhonebookAccess1SkeletonClass:
- * @parent_class: The parent class.
- *
- * Class structure for #OrgBluezObexPhonebookAccess1Skeleton.
- */
-
-struct _OrgBluezObexPhonebookAccess1SkeletonPrivate
-{
-  GValue *properties;
-  GList *changed_properties;
-  GSource *changed_properties_idle_source;
-  GMainContext *context;
-  GMutex lock;
-};
-
-static void
-_org_bluez_obex_phonebook_access1_skeleton_handle_method_call (
-  GDBusConnection *connection G_GNUC_UNUSED,
-  const gchar *sender G_GNUC_UNUSED,
-  const gchar *object_path G_GNUC_UNUSED,
-  const gchar *interface_name,
-  const gchar *method_name,
-  GVariant *parameters,
-  GDBusMethodInvocation *invocation,
-  gpointer user_data)
-{
-  OrgBluezObexPhonebookAccess1Skeleton *skeleton = ORG_BLUEZ_OBEX_PHONEBOOK_ACCESS1_SKELETON (user_data);
-  _ExtendedGDBusMethodInfo *info;
-  GVariantIter iter;
-  GVariant *child;
-  GValue *paramv;
-  gsize num_params;
-  guint num_extra;
-  gsize n;
-  guint signal_id;
-  GValue return_value = G_VALUE_INIT;
-  info = (_ExtendedGDBusMethodInfo *) g_dbus_method_invocation_get_method_info (invocation);
-  g_assert (info != NULL);
-  num_params = g_variant_n_children (parameters);
-  num_extra = info->pass_fdlist ? 3 : 2;  paramv = g_new0 (GValue, num_params + num_extra);
-  n = 0;
-  g_value_init (&paramv[n], TYPE_ORG_BLUEZ_OBEX_PHONEBOOK_ACCESS1);
-  g_value_set_object (&paramv[n++], skeleton);
-  g_value_init (&paramv[n], G_TYPE_DBUS_METHOD_INVOCATION);
-  g_value_set_object (&paramv[n++], invocation);
-  if (info->pass_fdlist)
-    {
-#ifdef G_OS_UNIX
-      g_value_init (&paramv[n], G_TYPE_UNIX_FD_LIST);
-      g_value_set_object (&paramv[n++], g_dbus_message_get_unix_fd_list (g_dbus_method_invocation_get_message (invocation)));
-#else
-      g_assert_not_reached ();
-#endif
-    }
-  g_variant_iter_init (&iter, parameters);
-  while ((child = g_variant_iter_next_value (&iter)) != NULL)
-    {
-      _ExtendedGDBusArgInfo *arg_info = (_ExtendedGDBusArgInfo *) info->parent_struct.in_args[n - num_extra];
-      if (arg_info->use_gvariant)
-        {
-          g_value_init (&paramv[n], G_TYPE_VARIANT);
-          g_value_set_variant (&paramv[n], child);
-          n++;
-        }
-      else
-        g_dbus_gvariant_to_gvalue (child, &paramv[n++]);
-      g_variant_unref (child);
-    }
-  signal_id = g_signal_lookup (info->signal_name, TYPE_ORG_BLUEZ_OBEX_PHONEBOOK_ACCESS1);
-  g_value_init (&return_value, G_TYPE_BOOLEAN);
-  g_signal_emitv (paramv, signal_id, 0, &return_value);
-  if (!g_value_get_boolean (&return_value))
-    g_dbus_method_invocation_return_error (invocation, G_DBUS_ERROR, G_DBUS_ERROR_UNKNOWN_METHOD, "Method %s is not implemented on interface %s", method_name, interface_name);
-  g_value_unset (&return_value);
-  for (n = 0; n < num_params + num_extra; n++)
-    g_value_unset (&paramv[n]);
-  g_free (paramv);
-}
-
-static GVariant *
-_org_bluez_obex_phonebook_access1_skeleton_handle_get_property (
-  GDBusConnection *connection G_GNUC_UNUSED,
-  const gchar *sender G_GNUC_UNUSED,
-  const gchar *object_path G_GNUC_UNUSED,
-  const gchar *interface_name G_GNUC_UNUSED,
-  const gchar *property_name,
-  GError **error,
-  gpointer user_data)
-{
-  OrgBluezObexPhonebookAccess1Skeleton *skeleton = ORG_BLUEZ_OBEX_PHONEBOOK_ACCESS1_SKELETON (user_data);
-  GValue value = G_VALUE_INIT;
-  GParamSpec *pspec;
-  _ExtendedGDBusPropertyInfo *info;
-  GVariant *ret;
-  ret = NULL;
-  info = (_ExtendedGDBusPropertyInfo *) g_dbus_interface_info_lookup_property ((GDBusInterfaceInfo *) &_org_bluez_obex_phonebook_access1_interface_info.parent_struct, property_name);
-  g_assert (info != NULL);
-  pspec = g_object_class_find_property (G_OBJECT_GET_CLASS (skeleton), info->hyphen_name);
-  if (pspec == NULL)
-    {
-      g_set_error (error, G_DBUS_ERROR, G_DBUS_ERROR_INVALID_ARGS, "No property with name %s", property_name);
-    }
-  else
-    {
-      g_value_init (&value, pspec->value_type);
-      g_object_get_property (G_OBJECT (skeleton), info->hyphen_name, &value);
-      ret = g_dbus_gvalue_to_gvariant (&value, G_VARIANT_TYPE (info->parent_struct.signature));
-      g_value_unset (&value);
-    }
-  return ret;
-}
-
-static gboolean
-_org_bluez_obex_phonebook_access1_skeleton_handle_set_property (
-  GDBusConnection *connection G_GNUC_UNUSED,
-  const gchar *sender G_GNUC_UNUSED,
-  const gchar *object_path G_GNUC_UNUSED,
-  const gchar *interface_name G_GNUC_UNUSED,
-  const gchar *property_name,
-  GVariant *variant,
-  GError **error,
-  gpointer user_data)
-{
-  OrgBluezObexPhonebookAccess1Skeleton *skeleton = ORG_BLUEZ_OBEX_PHONEBOOK_ACCESS1_SKELETON (user_data);
-  GValue value = G_VALUE_INIT;
-  GParamSpec *pspec;
-  _ExtendedGDBusPropertyInfo *info;
-  gboolean ret;
-  ret = FALSE;
-  info = (_ExtendedGDBusPropertyInfo *) g_dbus_interface_info_lookup_property ((GDBusInterfaceInfo *) &_org_bluez_obex_phonebook_access1_interface_info.parent_struct, property_name);
-  g_assert (info != NULL);
-  pspec = g_object_class_find_property (G_OBJECT_GET_CLASS (skeleton), info->hyphen_name);
-  if (pspec == NULL)
-    {
-      g_set_error (error, G_DBUS_ERROR, G_DBUS_ERROR_INVALID_ARGS, "No property with name %s", property_name);
-    }
-  else
-    {
-      if (info->use_gvariant)
-        g_value_set_variant (&value, variant);
-      else
-        g_dbus_gvariant_to_gvalue (variant, &value);
-      g_object_set_property (G_OBJECT (skeleton), info->hyphen_name, &value);
-      g_value_unset (&value);
-      ret = TRUE;
-    }
-  return ret;
-}
-
-static const GDBusInterfaceVTable _org_bluez_obex_phonebook_access1_skeleton_vtable =
-{
-  _org_bluez_obex_phonebook_access1_skeleton_handle_method_call,
-  _org_bluez_obex_phonebook_access1_skeleton_handle_get_property,
-  _org_bluez_obex_phonebook_access1_skeleton_handle_set_property,
-  {NULL}
-};
-
-static GDBusInterfaceInfo *
-org_bluez_obex_phonebook_access1_skeleton_dbus_interface_get_info (GDBusInterfaceSkeleton *skeleton G_GNUC_UNUSED)
-{
-  return org_bluez_obex_phonebook_access1_interface_info ();
-}
-
-static GDBusInterfaceVTable *
-org_bluez_obex_phonebook_access1_skeleton_dbus_interface_get_vtable (GDBusInterfaceSkeleton *skeleton G_GNUC_UNUSED)
-{
-  return (GDBusInterfaceVTable *) &_org_bluez_obex_phonebook_access1_skeleton_vtable;
-}
-
-static GVariant *
-org_bluez_obex_phonebook_access1_skeleton_dbus_interface_get_properties (GDBusInterfaceSkeleton *_skeleton)
-{
-  OrgBluezObexPhonebookAccess1Skeleton *skeleton = ORG_BLUEZ_OBEX_PHONEBOOK_ACCESS1_SKELETON (_skeleton);
-
-  GVariantBuilder builder;
-  guint n;
-  g_variant_builder_init (&builder, G_VARIANT_TYPE ("a{sv}"));
-  if (_org_bluez_obex_phonebook_access1_interface_info.parent_struct.properties == NULL)
-    goto out;
-  for (n = 0; _org_bluez_obex_phonebook_access1_interface_info.parent_struct.properties[n] != NULL; n++)
-    {
-      GDBusPropertyInfo *info = _org_bluez_obex_phonebook_access1_interface_info.parent_struct.properties[n];
-      if (info->flags & G_DBUS_PROPERTY_INFO_FLAGS_READABLE)
-        {
-          GVariant *value;
-          value = _org_bluez_obex_phonebook_access1_skeleton_handle_get_property (g_dbus_interface_skeleton_get_connection (G_DBUS_INTERFACE_SKELETON (skeleton)), NULL, g_dbus_interface_skeleton_get_object_path (G_DBUS_INTERFACE_SKELETON (skeleton)), "org.bluez.obex.PhonebookAccess1", info->name, NULL, skeleton);
-          if (value != NULL)
-            {
-              g_variant_take_ref (value);
-              g_variant_builder_add (&builder, "{sv}", info->name, value);
-              g_variant_unref (value);
-            }
-        }
-    }
-out:
-  return g_variant_builder_end (&builder);
-}
-
-static gboolean _org_bluez_obex_phonebook_access1_emit_changed (gpointer user_data);
-
-static void
-org_bluez_obex_phonebook_access1_skeleton_dbus_interface_flush (GDBusInterfaceSkeleton *_skeleton)
-{
-  OrgBluezObexPhonebookAccess1Skeleton *skeleton = ORG_BLUEZ_OBEX_PHONEBOOK_ACCESS1_SKELETON (_skeleton);
-  gboolean emit_changed = FALSE;
-
-  g_mutex_lock (&skeleton->priv->lock);
-  if (skeleton->priv->changed_properties_idle_source != NULL)
-    {
-      g_source_destroy (skeleton->priv->changed_properties_idle_source);
-      skeleton->priv->changed_properties_idle_source = NULL;
-      emit_changed = TRUE;
-    }
-  g_mutex_unlock (&skeleton->priv->lock);
-
-  if (emit_changed)
-    _org_bluez_obex_phonebook_access1_emit_changed (skeleton);
-}
-
-static void org_bluez_obex_phonebook_access1_skeleton_iface_init (OrgBluezObexPhonebookAccess1Iface *iface);
-#if GLIB_VERSION_MAX_ALLOWED >= GLIB_VERSION_2_38
-G_DEFINE_TYPE_WITH_CODE (OrgBluezObexPhonebookAccess1Skeleton, org_bluez_obex_phonebook_access1_skeleton, G_TYPE_DBUS_INTERFACE_SKELETON,
-                         G_ADD_PRIVATE (OrgBluezObexPhonebookAccess1Skeleton)
-                         G_IMPLEMENT_INTERFACE (TYPE_ORG_BLUEZ_OBEX_PHONEBOOK_ACCESS1, org_bluez_obex_phonebook_access1_skeleton_iface_init))
-
-#else
-G_DEFINE_TYPE_WITH_CODE (OrgBluezObexPhonebookAccess1Skeleton, org_bluez_obex_phonebook_access1_skeleton, G_TYPE_DBUS_INTERFACE_SKELETON,
-                         G_IMPLEMENT_INTERFACE (TYPE_ORG_BLUEZ_OBEX_PHONEBOOK_ACCESS1, org_bluez_obex_phonebook_access1_skeleton_iface_init))
-
-#endif
-static void
-org_bluez_obex_phonebook_access1_skeleton_finalize (GObject *object)
-{
-  OrgBluezObexPhonebookAccess1Skeleton *skeleton = ORG_BLUEZ_OBEX_PHONEBOOK_ACCESS1_SKELETON (object);
-  guint n;
-  for (n = 0; n < 5; n++)
-    g_value_unset (&skeleton->priv->properties[n]);
-  g_free (skeleton->priv->properties);
-  g_list_free_full (skeleton->priv->changed_properties, (GDestroyNotify) _changed_property_free);
-  if (skeleton->priv->changed_properties_idle_source != NULL)
-    g_source_destroy (skeleton->priv->changed_properties_idle_source);
-  g_main_context_unref (skeleton->priv->context);
-  g_mutex_clear (&skeleton->priv->lock);
-  G_OBJECT_CLASS (org_bluez_obex_phonebook_access1_skeleton_parent_class)->finalize (object);
-}
-
-static void
-org_bluez_obex_phonebook_access1_skeleton_get_property (GObject      *object,
-  guint         prop_id,
-  GValue       *value,
-  GParamSpec   *pspec G_GNUC_UNUSED)
-{
-  OrgBluezObexPhonebookAccess1Skeleton *skeleton = ORG_BLUEZ_OBEX_PHONEBOOK_ACCESS1_SKELETON (object);
-  g_assert (prop_id != 0 && prop_id - 1 < 5);
-  g_mutex_lock (&skeleton->priv->lock);
-  g_value_copy (&skeleton->priv->properties[prop_id - 1], value);
-  g_mutex_unlock (&skeleton->priv->lock);
-}
-
-static gboolean
-_org_bluez_obex_phonebook_access1_emit_changed (gpointer user_data)
-{
-  OrgBluezObexPhonebookAccess1Skeleton *skeleton = ORG_BLUEZ_OBEX_PHONEBOOK_ACCESS1_SKELETON (user_data);
-  GList *l;
-  GVariantBuilder builder;
-  GVariantBuilder invalidated_builder;
-  guint num_changes;
-
-  g_mutex_lock (&skeleton->priv->lock);
-  g_variant_builder_init (&builder, G_VARIANT_TYPE ("a{sv}"));
-  g_variant_builder_init (&invalidated_builder, G_VARIANT_TYPE ("as"));
-  for (l = skeleton->priv->changed_properties, num_changes = 0; l != NULL; l = l->next)
-    {
-      ChangedProperty *cp = l->data;
-      GVariant *variant;
-      const GValue *cur_value;
-
-      cur_value = &skeleton->priv->properties[cp->prop_id - 1];
-      if (!_g_value_equal (cur_value, &cp->orig_value))
-        {
-          variant = g_dbus_gvalue_to_gvariant (cur_value, G_VARIANT_TYPE (cp->info->parent_struct.signature));
-          g_variant_builder_add (&builder, "{sv}", cp->info->parent_struct.name, variant);
-          g_variant_unref (variant);
-          num_changes++;
-        }
-    }
-  if (num_changes > 0)
-    {
-      GList *connections, *ll;
-      GVariant *signal_variant;
-      signal_variant = g_variant_ref_sink (g_variant_new ("(sa{sv}as)", "org.bluez.obex.PhonebookAccess1",
-                                           &builder, &invalidated_builder));
-      connections = g_dbus_interface_skeleton_get_connections (G_DBUS_INTERFACE_SKELETON (skeleton));
-      for (ll = connections; ll != NULL; ll = ll->next)
-        {
-          GDBusConnection *connection = ll->data;
-
-          g_dbus_connection_emit_signal (connection,
-                                         NULL, g_dbus_interface_skeleton_get_object_path (G_DBUS_INTERFACE_SKELETON (skeleton)),
-                                         "org.freedesktop.DBus.Properties",
-                                         "PropertiesChanged",
-                                         signal_variant,
-                                         NULL);
-        }
-      g_variant_unref (signal_variant);
-      g_list_free_full (connections, g_object_unref);
-    }
-  else
-    {
-      g_variant_builder_clear (&builder);
-      g_variant_builder_clear (&invalidated_builder);
-    }
-  g_list_free_full (skeleton->priv->changed_properties, (GDestroyNotify) _changed_property_free);
-  skeleton->priv->changed_properties = NULL;
-  skeleton->priv->changed_properties_idle_source = NULL;
-  g_mutex_unlock (&skeleton->priv->lock);
-  return FALSE;
-}
-
-static void
-_org_bluez_obex_phonebook_access1_schedule_emit_changed (OrgBluezObexPhonebookAccess1Skeleton *skeleton, const _ExtendedGDBusPropertyInfo *info, guint prop_id, const GValue *orig_value)
-{
-  ChangedProperty *cp;
-  GList *l;
-  cp = NULL;
-  for (l = skeleton->priv->changed_properties; l != NULL; l = l->next)
-    {
-      ChangedProperty *i_cp = l->data;
-      if (i_cp->info == info)
-        {
-          cp = i_cp;
-          break;
-        }
-    }
-  if (cp == NULL)
-    {
-      cp = g_new0 (ChangedProperty, 1);
-      cp->prop_id = prop_id;
-      cp->info = info;
-      skeleton->priv->changed_properties = g_list_prepend (skeleton->priv->changed_properties, cp);
-      g_value_init (&cp->orig_value, G_VALUE_TYPE (orig_value));
-      g_value_copy (orig_value, &cp->orig_value);
-    }
-}
-
-static void
-org_bluez_obex_phonebook_access1_skeleton_notify (GObject      *object,
-  GParamSpec *pspec G_GNUC_UNUSED)
-{
-  OrgBluezObexPhonebookAccess1Skeleton *skeleton = ORG_BLUEZ_OBEX_PHONEBOOK_ACCESS1_SKELETON (object);
-  g_mutex_lock (&skeleton->priv->lock);
-  if (skeleton->priv->changed_properties != NULL &&
-      skeleton->priv->changed_properties_idle_source == NULL)
-    {
-      skeleton->priv->changed_properties_idle_source = g_idle_source_new ();
-      g_source_set_priority (skeleton->priv->changed_properties_idle_source, G_PRIORITY_DEFAULT);
-      g_source_set_callback (skeleton->priv->changed_properties_idle_source, _org_bluez_obex_phonebook_access1_emit_changed, g_object_ref (skeleton), (GDestroyNotify) g_object_unref);
-      g_source_set_name (skeleton->priv->changed_properties_idle_source, "[generated] _org_bluez_obex_phonebook_access1_emit_changed");
-      g_source_attach (skeleton->priv->changed_properties_idle_source, skeleton->priv->context);
-      g_source_unref (skeleton->priv->changed_properties_idle_source);
-    }
-  g_mutex_unlock (&skeleton->priv->lock);
-}
-
-static void
-org_bluez_obex_phonebook_access1_skeleton_set_property (GObject      *object,
-  guint         prop_id,
-  const GValue *value,
-  GParamSpec   *pspec)
-{
-  OrgBluezObexPhonebookAccess1Skeleton *skeleton = ORG_BLUEZ_OBEX_PHONEBOOK_ACCESS1_SKELETON (object);
-  g_assert (prop_id != 0 && prop_id - 1 < 5);
-  g_mutex_lock (&skeleton->priv->lock);
-  g_object_freeze_notify (object);
-  if (!_g_value_equal (value, &skeleton->priv->properties[prop_id - 1]))
-    {
-      if (g_dbus_interface_skeleton_get_connection (G_DBUS_INTERFACE_SKELETON (skeleton)) != NULL)
-        _org_bluez_obex_phonebook_access1_schedule_emit_changed (skeleton, _org_bluez_obex_phonebook_access1_property_info_pointers[prop_id - 1], prop_id, &skeleton->priv->properties[prop_id - 1]);
-      g_value_copy (value, &skeleton->priv->properties[prop_id - 1]);
-      g_object_notify_by_pspec (object, pspec);
-    }
-  g_mutex_unlock (&skeleton->priv->lock);
-  g_object_thaw_notify (object);
-}
-
-static void
-org_bluez_obex_phonebook_access1_skeleton_init (OrgBluezObexPhonebookAccess1Skeleton *skeleton)
-{
-#if GLIB_VERSION_MAX_ALLOWED >= GLIB_VERSION_2_38
-  skeleton->priv = org_bluez_obex_phonebook_access1_skeleton_get_instance_private (skeleton);
-#else
-  skeleton->priv = G_TYPE_INSTANCE_GET_PRIVATE (skeleton, TYPE_ORG_BLUEZ_OBEX_PHONEBOOK_ACCESS1_SKELETON, OrgBluezObexPhonebookAccess1SkeletonPrivate);
-#endif
-
-  g_mutex_init (&skeleton->priv->lock);
-  skeleton->priv->context = g_main_context_ref_thread_default ();
-  skeleton->priv->properties = g_new0 (GValue, 5);
-  g_value_init (&skeleton->priv->properties[0], G_TYPE_STRING);
-  g_value_init (&skeleton->priv->properties[1], G_TYPE_STRING);
-  g_value_init (&skeleton->priv->properties[2], G_TYPE_STRING);
-  g_value_init (&skeleton->priv->properties[3], G_TYPE_STRING);
-  g_value_init (&skeleton->priv->properties[4], G_TYPE_BOOLEAN);
-}
-
-static const gchar *
-org_bluez_obex_phonebook_access1_skeleton_get_folder (OrgBluezObexPhonebookAccess1 *object)
-{
-  OrgBluezObexPhonebookAccess1Skeleton *skeleton = ORG_BLUEZ_OBEX_PHONEBOOK_ACCESS1_SKELETON (object);
-  const gchar *value;
-  g_mutex_lock (&skeleton->priv->lock);
-  value = g_value_get_string (&(skeleton->priv->properties[0]));
-  g_mutex_unlock (&skeleton->priv->lock);
-  return value;
-}
-
-static const gchar *
-org_bluez_obex_phonebook_access1_skeleton_get_database_identifier (OrgBluezObexPhonebookAccess1 *object)
-{
-  OrgBluezObexPhonebookAccess1Skeleton *skeleton = ORG_BLUEZ_OBEX_PHONEBOOK_ACCESS1_SKELETON (object);
-  const gchar *value;
-  g_mutex_lock (&skeleton->priv->lock);
-  value = g_value_get_string (&(skeleton->priv->properties[1]));
-  g_mutex_unlock (&skeleton->priv->lock);
-  return value;
-}
-
-static const gchar *
-org_bluez_obex_phonebook_access1_skeleton_get_primary_counter (OrgBluezObexPhonebookAccess1 *object)
-{
-  OrgBluezObexPhonebookAccess1Skeleton *skeleton = ORG_BLUEZ_OBEX_PHONEBOOK_ACCESS1_SKELETON (object);
-  const gchar *value;
-  g_mutex_lock (&skeleton->priv->lock);
-  value = g_value_get_string (&(skeleton->priv->properties[2]));
-  g_mutex_unlock (&skeleton->priv->lock);
-  return value;
-}
-
-static const gchar *
-org_bluez_obex_phonebook_access1_skeleton_get_secondary_counter (OrgBluezObexPhonebookAccess1 *object)
-{
-  OrgBluezObexPhonebookAccess1Skeleton *skeleton = ORG_BLUEZ_OBEX_PHONEBOOK_ACCESS1_SKELETON (object);
-  const gchar *value;
-  g_mutex_lock (&skeleton->priv->lock);
-  value = g_value_get_string (&(skeleton->priv->properties[3]));
-  g_mutex_unlock (&skeleton->priv->lock);
-  return value;
-}
-
-static gboolean 
-org_bluez_obex_phonebook_access1_skeleton_get_fixed_image_size (OrgBluezObexPhonebookAccess1 *object)
-{
-  OrgBluezObexPhonebookAccess1Skeleton *skeleton = ORG_BLUEZ_OBEX_PHONEBOOK_ACCESS1_SKELETON (object);
-  gboolean value;
-  g_mutex_lock (&skeleton->priv->lock);
-  value = g_value_get_boolean (&(skeleton->priv->properties[4]));
-  g_mutex_unlock (&skeleton->priv->lock);
-  return value;
-}
-
-static void
-org_bluez_obex_phonebook_access1_skeleton_class_init (OrgBluezObexPhonebookAccess1SkeletonClass *klass)
-{
-  GObjectClass *gobject_class;
-  GDBusInterfaceSkeletonClass *skeleton_class;
-
-  gobject_class = G_OBJECT_CLASS (klass);
-  gobject_class->finalize = org_bluez_obex_phonebook_access1_skeleton_finalize;
-  gobject_class->get_property = org_bluez_obex_phonebook_access1_skeleton_get_property;
-  gobject_class->set_property = org_bluez_obex_phonebook_access1_skeleton_set_property;
-  gobject_class->notify       = org_bluez_obex_phonebook_access1_skeleton_notify;
-
-
-  org_bluez_obex_phonebook_access1_override_properties (gobject_class, 1);
-
-  skeleton_class = G_DBUS_INTERFACE_SKELETON_CLASS (klass);
-  skeleton_class->get_info = org_bluez_obex_phonebook_access1_skeleton_dbus_interface_get_info;
-  skeleton_class->get_properties = org_bluez_obex_phonebook_access1_skeleton_dbus_interface_get_properties;
-  skeleton_class->flush = org_bluez_obex_phonebook_access1_skeleton_dbus_interface_flush;
-  skeleton_class->get_vtable = org_bluez_obex_phonebook_access1_skeleton_dbus_interface_get_vtable;
-
-#if GLIB_VERSION_MAX_ALLOWED < GLIB_VERSION_2_38
-  g_type_class_add_private (klass, sizeof (OrgBluezObexPhonebookAccess1SkeletonPrivate));
-#endif
-}
-
-static void
-org_bluez_obex_phonebook_access1_skeleton_iface_init (OrgBluezObexPhonebookAccess1Iface *iface)
-{
-  iface->get_folder = org_bluez_obex_phonebook_access1_skeleton_get_folder;
-  iface->get_database_identifier = org_bluez_obex_phonebook_access1_skeleton_get_database_identifier;
-  iface->get_primary_counter = org_bluez_obex_phonebook_access1_skeleton_get_primary_counter;
-  iface->get_secondary_counter = org_bluez_obex_phonebook_access1_skeleton_get_secondary_counter;
-  iface->get_fixed_image_size = org_bluez_obex_phonebook_access1_skeleton_get_fixed_image_size;
-}
-
-/**
- * org_bluez_obex_phonebook_access1_skeleton_new:
- *
- * Creates a skeleton object for the D-Bus interface <link linkend="gdbus-interface-org-bluez-obex-PhonebookAccess1.top_of_page">org.bluez.obex.PhonebookAccess1</link>.
- *
- * Returns: (transfer full) (type OrgBluezObexPhonebookAccess1Skeleton): The skeleton object.
- */
-OrgBluezObexPhonebookAccess1 *
-org_bluez_obex_phonebook_access1_skeleton_new (void)
-{
-  return ORG_BLUEZ_OBEX_PHONEBOOK_ACCESS1 (g_object_new (TYPE_ORG_BLUEZ_OBEX_PHONEBOOK_ACCESS1_SKELETON, NULL));
-}
-
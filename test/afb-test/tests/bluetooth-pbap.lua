@@ -21,6 +21,7 @@
 --]]
 
 _AFT.testVerbStatusSuccess('testContactsSuccess','bluetooth-pbap','contacts', {})
+_AFT.testVerbStatusSuccess('testListingSuccess','bluetooth-pbap','listing', {})
 _AFT.testVerbStatusSuccess('testIncomingCallsEntrySuccess','bluetooth-pbap','entry', {list="ich",handle="1.vcf"})
 _AFT.testVerbStatusSuccess('testOutgoingCallsEntrySuccess','bluetooth-pbap','entry', {list="och",handle="1.vcf"})
 _AFT.testVerbStatusSuccess('testMissedCallsEntrySuccess','bluetooth-pbap','entry', {list="mch",handle="1.vcf"})
@@ -32,5 +33,22 @@ _AFT.testVerbStatusSuccess('testMissedCallsHistorySuccess','bluetooth-pbap','his
 _AFT.testVerbStatusSuccess('testCombinedCallsHistorySuccess','bluetooth-pbap','history', {list="cch"})
 _AFT.testVerbStatusSuccess('testSearchSuccess','bluetooth-pbap','search', {number="100"})
 _AFT.testVerbStatusSuccess('testStatusSuccess','bluetooth-pbap','status', {value="connected"})
+_AFT.testVerbStatusSuccess('testMetricsSuccess','bluetooth-pbap','metrics', {})
 _AFT.testVerbStatusSuccess('testSubscribeStatusSuccess','bluetooth-pbap','subscribe', {value="status"})
 _AFT.testVerbStatusSuccess('testUnsubscribeStatusSuccess','bluetooth-pbap','unsubscribe', {value="status"})
+_AFT.testVerbStatusSuccess('testSubscribeContactsChangedSuccess','bluetooth-pbap','subscribe', {value="contacts_changed"})
+_AFT.testVerbStatusSuccess('testUnsubscribeContactsChangedSuccess','bluetooth-pbap','unsubscribe', {value="contacts_changed"})
+_AFT.testVerbStatusSuccess('testSubscribeHistoryChangedSuccess','bluetooth-pbap','subscribe', {value="history_changed"})
+_AFT.testVerbStatusSuccess('testUnsubscribeHistoryChangedSuccess','bluetooth-pbap','unsubscribe', {value="history_changed"})
+_AFT.testVerbStatusSuccess('testSubscribeCallerIdSuccess','bluetooth-pbap','subscribe', {value="caller_id"})
+_AFT.testVerbStatusSuccess('testUnsubscribeCallerIdSuccess','bluetooth-pbap','unsubscribe', {value="caller_id"})
+_AFT.testVerbStatusSuccess('testSubscribeSyncProgressSuccess','bluetooth-pbap','subscribe', {value="sync_progress"})
+_AFT.testVerbStatusSuccess('testUnsubscribeSyncProgressSuccess','bluetooth-pbap','unsubscribe', {value="sync_progress"})
+_AFT.testVerbStatusSuccess('testSubscribeFilteredSuccess','bluetooth-pbap','subscribe', {value="sync_progress",list="pb",interval="1000"})
+_AFT.testVerbStatusSuccess('testUnsubscribeFilteredSuccess','bluetooth-pbap','unsubscribe', {value="sync_progress",list="pb",interval="1000"})
+_AFT.testVerbStatusError('testSubscribeInvalidIntervalError','bluetooth-pbap','subscribe', {value="sync_progress",interval="-1"})
+_AFT.testVerbStatusSuccess('testSubscribeDeviceFilterSuccess','bluetooth-pbap','subscribe', {value="sync_progress",device="dev_F8_34_41_DE_C3_6F"})
+_AFT.testVerbStatusError('testSubscribeInvalidDeviceError','bluetooth-pbap','subscribe', {value="sync_progress",device="phone"})
+_AFT.testVerbStatusError('testContactsUnknownDeviceError','bluetooth-pbap','contacts', {device="00:00:00:00:00:00"})
+_AFT.testVerbStatusError('testHistoryInvalidTimeoutError','bluetooth-pbap','history', {list="cch",timeout=-1})
+_AFT.testVerbStatusError('testContactsMaxEntriesRangeError','bluetooth-pbap','contacts', {max_entries=131071})
@@ -0,0 +1,479 @@
+/*
+ * Copyright (C) 2018 Konsulko Group
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Tests of the modules that need neither a phone nor a binder: the
+ * codec, change deltas, the entry cache, vCard parsing and the
+ * numbers index.
+ */
+
+#include <glib.h>
+#include <json-c/json.h>
+#include <string.h>
+
+#define AFB_BINDING_VERSION 3
+#include <afb/afb-binding.h>
+
+#include "bluetooth-pbap-codec.h"
+#include "bluetooth-pbap-delta.h"
+#include "bluetooth-pbap-lru.h"
+#include "bluetooth-pbap-numbers.h"
+#include "bluetooth-pbap-vcard.h"
+
+/* set by the binder otherwise, a zero log mask keeps the modules quiet */
+static struct afb_api_x3 test_api;
+struct afb_api_x3 *afbBindingV3root = &test_api;
+
+#define CARD_ART	"BEGIN:VCARD\r\nVERSION:3.0\r\nFN:Art McGee\r\n" \
+			"TEL;TYPE=CELL:+1 (503) 555-1212\r\nPHOTO;ENCODING=b:AAAA\r\n" \
+			"END:VCARD\r\n"
+#define CARD_BOB	"BEGIN:VCARD\r\nVERSION:3.0\r\nFN:Bob\r\n" \
+			"item1.TEL:0044 20 7946 0018\r\nTEL:5551234\r\nEND:VCARD\r\n"
+#define CARD_EVE	"BEGIN:VCARD\r\nVERSION:3.0\r\nFN:Eve\r\nEND:VCARD\r\n"
+
+static GPtrArray *strv_array(const gchar *first, ...)
+{
+	GPtrArray *array = g_ptr_array_new_with_free_func(g_free);
+	const gchar *s;
+	va_list ap;
+
+	va_start(ap, first);
+	for (s = first; s; s = va_arg(ap, const gchar *))
+		g_ptr_array_add(array, g_strdup(s));
+	va_end(ap);
+
+	return array;
+}
+
+static gint array_length(struct json_object *jso, const gchar *name)
+{
+	struct json_object *array = NULL;
+
+	if (!json_object_object_get_ex(jso, name, &array))
+		return -1;
+
+	return json_object_array_length(array);
+}
+
+static const gchar *array_get(struct json_object *jso, const gchar *name,
+			      gint i)
+{
+	struct json_object *array = NULL;
+
+	json_object_object_get_ex(jso, name, &array);
+
+	return json_object_get_string(json_object_array_get_idx(array, i));
+}
+
+static void codec_round_trip(enum pbap_codec codec)
+{
+	struct json_object *jso, *decoded, *val = NULL;
+	const gchar *text;
+	GString *vcards = g_string_new(NULL);
+	gchar *encoded, *tag;
+	int i;
+
+	/* large enough to span several chunks of the streaming decoder */
+	for (i = 0; i < 2000; i++)
+		g_string_append(vcards, CARD_ART);
+
+	jso = json_object_new_object();
+	json_object_object_add(jso, "vcards",
+		json_object_new_string_len(vcards->str, vcards->len));
+	text = json_object_to_json_string_ext(jso, JSON_C_TO_STRING_PLAIN);
+
+	encoded = pbap_codec_encode(codec, text, strlen(text));
+	g_assert_nonnull(encoded);
+
+	if (codec == PBAP_CODEC_NONE) {
+		g_assert_cmpstr(encoded, ==, text);
+	} else {
+		tag = g_strconcat(pbap_codec_to_string(codec), ":", NULL);
+		g_assert_true(g_str_has_prefix(encoded, tag));
+		g_assert_cmpuint(strlen(encoded), <, strlen(text));
+		g_free(tag);
+	}
+
+	decoded = pbap_codec_decode_json(encoded);
+	g_assert_nonnull(decoded);
+	g_assert_true(json_object_object_get_ex(decoded, "vcards", &val));
+	g_assert_cmpstr(json_object_get_string(val), ==, vcards->str);
+
+	json_object_put(decoded);
+	json_object_put(jso);
+	g_free(encoded);
+	g_string_free(vcards, TRUE);
+}
+
+static void test_codec_none(void)
+{
+	codec_round_trip(PBAP_CODEC_NONE);
+}
+
+static void test_codec_zlib(void)
+{
+	codec_round_trip(PBAP_CODEC_ZLIB);
+}
+
+static void test_codec_zstd(void)
+{
+	enum pbap_codec codec;
+
+	if (!pbap_codec_from_string("zstd", &codec)) {
+		g_test_skip("built without zstd");
+		return;
+	}
+
+	codec_round_trip(codec);
+}
+
+static void test_codec_names(void)
+{
+	enum pbap_codec codec = PBAP_CODEC_NONE;
+
+	g_assert_true(pbap_codec_from_string("zlib", &codec));
+	g_assert_cmpint(codec, ==, PBAP_CODEC_ZLIB);
+	g_assert_cmpstr(pbap_codec_to_string(codec), ==, "zlib");
+	g_assert_false(pbap_codec_from_string("lz4", &codec));
+	g_assert_cmpint(codec, ==, PBAP_CODEC_ZLIB);
+}
+
+/* values written before the codec was introduced are plain JSON */
+static void test_codec_legacy(void)
+{
+	struct json_object *decoded, *val = NULL;
+
+	decoded = pbap_codec_decode_json("{\"vcards\":\"BEGIN:VCARD\\r\\nEND:VCARD\\r\\n\"}");
+	g_assert_nonnull(decoded);
+	g_assert_true(json_object_object_get_ex(decoded, "vcards", &val));
+	g_assert_cmpstr(json_object_get_string(val), ==, "BEGIN:VCARD\r\nEND:VCARD\r\n");
+	json_object_put(decoded);
+
+	decoded = pbap_codec_decode_json("[1, 2]");
+	g_assert_nonnull(decoded);
+	g_assert_true(json_object_is_type(decoded, json_type_array));
+	json_object_put(decoded);
+}
+
+static void test_codec_corrupt(void)
+{
+	gchar *encoded = pbap_codec_encode(PBAP_CODEC_ZLIB, "{\"a\":1}", 7);
+
+	/* truncated payload, unknown tag */
+	encoded[strlen(encoded) / 2 + 2] = '\0';
+	g_assert_null(pbap_codec_decode_json(encoded));
+	g_assert_null(pbap_codec_decode_json("lz4:AAAA"));
+
+	g_free(encoded);
+}
+
+static void test_delta_handles(void)
+{
+	GPtrArray *cards, *handles;
+	struct json_object *delta;
+
+	cards = strv_array(CARD_ART, CARD_BOB, NULL);
+	handles = strv_array("1.vcf", "2.vcf", NULL);
+
+	/* the first list is only the baseline */
+	g_assert_null(pbap_delta_update("test/pb", cards, handles));
+	g_assert_null(pbap_delta_update("test/pb", cards, handles));
+	g_ptr_array_unref(cards);
+	g_ptr_array_unref(handles);
+
+	/* sparse handles, as left by deleted contacts */
+	cards = strv_array(CARD_ART, CARD_EVE, CARD_EVE, NULL);
+	handles = strv_array("1.vcf", "2.vcf", "7.vcf", NULL);
+
+	delta = pbap_delta_update("test/pb", cards, handles);
+	g_assert_nonnull(delta);
+	g_assert_cmpint(array_length(delta, "added"), ==, 1);
+	g_assert_cmpstr(array_get(delta, "added", 0), ==, "7.vcf");
+	g_assert_cmpint(array_length(delta, "removed"), ==, 0);
+	g_assert_cmpint(array_length(delta, "modified"), ==, 1);
+	g_assert_cmpstr(array_get(delta, "modified", 0), ==, "2.vcf");
+	json_object_put(delta);
+
+	g_ptr_array_unref(cards);
+	g_ptr_array_unref(handles);
+}
+
+static void test_delta_records(void)
+{
+	GPtrArray *cards;
+	struct json_object *delta;
+
+	cards = strv_array(CARD_ART, CARD_BOB, NULL);
+	g_assert_null(pbap_delta_update("test/cch", cards, NULL));
+	g_ptr_array_unref(cards);
+
+	cards = strv_array(CARD_BOB, CARD_EVE, NULL);
+	delta = pbap_delta_update("test/cch", cards, NULL);
+	g_assert_nonnull(delta);
+	g_assert_cmpint(array_length(delta, "added"), ==, 1);
+	g_assert_cmpstr(array_get(delta, "added", 0), ==, CARD_EVE);
+	g_assert_cmpint(array_length(delta, "removed"), ==, 1);
+	g_assert_cmpstr(array_get(delta, "removed", 0), ==, CARD_ART);
+	g_assert_cmpint(array_length(delta, "modified"), ==, -1);
+	json_object_put(delta);
+	g_ptr_array_unref(cards);
+}
+
+static struct json_object *delta_new(const gchar *added, const gchar *removed,
+				     const gchar *modified, gint64 version)
+{
+	struct json_object *delta = json_object_new_object();
+	struct json_object *array;
+
+	array = json_object_new_array();
+	if (added)
+		json_object_array_add(array, json_object_new_string(added));
+	json_object_object_add(delta, "added", array);
+
+	array = json_object_new_array();
+	if (removed)
+		json_object_array_add(array, json_object_new_string(removed));
+	json_object_object_add(delta, "removed", array);
+
+	array = json_object_new_array();
+	if (modified)
+		json_object_array_add(array, json_object_new_string(modified));
+	json_object_object_add(delta, "modified", array);
+
+	json_object_object_add(delta, "version", json_object_new_int64(version));
+
+	return delta;
+}
+
+static void test_delta_merge(void)
+{
+	struct json_object *pending, *delta, *val = NULL;
+
+	pending = delta_new("1.vcf", "2.vcf", NULL, 1);
+
+	/* added then removed is dropped, removed then added is modified */
+	delta = delta_new("2.vcf", "1.vcf", "3.vcf", 2);
+	pbap_delta_merge(pending, delta);
+	json_object_put(delta);
+
+	g_assert_cmpint(array_length(pending, "added"), ==, 0);
+	g_assert_cmpint(array_length(pending, "removed"), ==, 0);
+	g_assert_cmpint(array_length(pending, "modified"), ==, 2);
+	g_assert_cmpstr(array_get(pending, "modified", 0), ==, "2.vcf");
+	g_assert_cmpstr(array_get(pending, "modified", 1), ==, "3.vcf");
+	g_assert_true(json_object_object_get_ex(pending, "version", &val));
+	g_assert_cmpint(json_object_get_int64(val), ==, 2);
+
+	json_object_put(pending);
+}
+
+static void test_lru_evict(void)
+{
+	struct pbap_lru *lru = pbap_lru_new(2, 0);
+	gchar *value;
+
+	pbap_lru_insert(lru, "a", "1");
+	pbap_lru_insert(lru, "b", "2");
+
+	/* a is used last, so b goes */
+	value = pbap_lru_lookup(lru, "a");
+	g_assert_cmpstr(value, ==, "1");
+	g_free(value);
+	pbap_lru_insert(lru, "c", "3");
+
+	g_assert_null(pbap_lru_lookup(lru, "b"));
+	value = pbap_lru_lookup(lru, "c");
+	g_assert_cmpstr(value, ==, "3");
+	g_free(value);
+
+	pbap_lru_remove_prefix(lru, "c");
+	g_assert_null(pbap_lru_lookup(lru, "c"));
+
+	pbap_lru_free(lru);
+}
+
+static void test_lru_bytes(void)
+{
+	struct pbap_lru *lru = pbap_lru_new(0, 8);
+	struct json_object *stats, *val = NULL;
+	gchar *value;
+
+	pbap_lru_insert(lru, "a", "12345");
+	pbap_lru_insert(lru, "b", "12345");
+	g_assert_null(pbap_lru_lookup(lru, "a"));
+
+	/* the most recent entry is kept even past the budget */
+	pbap_lru_insert(lru, "c", "1234567890");
+	value = pbap_lru_lookup(lru, "c");
+	g_assert_cmpstr(value, ==, "1234567890");
+	g_free(value);
+
+	stats = pbap_lru_stats(lru);
+	g_assert_true(json_object_object_get_ex(stats, "entries", &val));
+	g_assert_cmpint(json_object_get_int(val), ==, 1);
+	g_assert_true(json_object_object_get_ex(stats, "evictions", &val));
+	g_assert_cmpint(json_object_get_int(val), ==, 2);
+	json_object_put(stats);
+
+	pbap_lru_free(lru);
+}
+
+static void test_lru_prefill(void)
+{
+	struct pbap_lru *lru = pbap_lru_new(2, 0);
+	gchar *value;
+
+	g_assert_true(pbap_lru_prefill(lru, "a", "1"));
+	pbap_lru_insert(lru, "b", "2");
+
+	/* refreshed in place, but nothing is evicted to make room */
+	g_assert_true(pbap_lru_prefill(lru, "a", "10"));
+	g_assert_false(pbap_lru_prefill(lru, "c", "3"));
+
+	value = pbap_lru_lookup(lru, "a");
+	g_assert_cmpstr(value, ==, "10");
+	g_free(value);
+	g_assert_null(pbap_lru_lookup(lru, "c"));
+
+	pbap_lru_free(lru);
+}
+
+static void test_vcard_split(void)
+{
+	GPtrArray *cards;
+
+	cards = pbap_vcard_split("garbage" CARD_ART CARD_BOB "BEGIN:VCARD\r\nFN:cut");
+	g_assert_cmpuint(cards->len, ==, 2);
+	g_assert_cmpstr(g_ptr_array_index(cards, 0), ==, CARD_ART);
+	g_assert_cmpstr(g_ptr_array_index(cards, 1), ==, CARD_BOB);
+	g_ptr_array_unref(cards);
+
+	cards = pbap_vcard_split("");
+	g_assert_cmpuint(cards->len, ==, 0);
+	g_ptr_array_unref(cards);
+}
+
+static void test_vcard_values(void)
+{
+	GPtrArray *values;
+
+	values = pbap_vcard_get_values(CARD_BOB, "TEL");
+	g_assert_cmpuint(values->len, ==, 2);
+	g_assert_cmpstr(g_ptr_array_index(values, 0), ==, "0044 20 7946 0018");
+	g_assert_cmpstr(g_ptr_array_index(values, 1), ==, "5551234");
+	g_ptr_array_unref(values);
+
+	values = pbap_vcard_get_values(CARD_ART, "fn");
+	g_assert_cmpuint(values->len, ==, 1);
+	g_assert_cmpstr(g_ptr_array_index(values, 0), ==, "Art McGee");
+	g_ptr_array_unref(values);
+
+	g_assert_true(pbap_vcard_has_property(CARD_ART, "PHOTO"));
+	g_assert_false(pbap_vcard_has_property(CARD_BOB, "PHOTO"));
+}
+
+static void assert_caller(const gchar *address, const gchar *number,
+			  const gchar *name, const gchar *handle)
+{
+	struct json_object *jresp, *val = NULL;
+
+	jresp = pbap_numbers_lookup(address, number);
+	if (!name) {
+		g_assert_null(jresp);
+		return;
+	}
+
+	g_assert_nonnull(jresp);
+	g_assert_true(json_object_object_get_ex(jresp, "name", &val));
+	g_assert_cmpstr(json_object_get_string(val), ==, name);
+	if (handle) {
+		g_assert_true(json_object_object_get_ex(jresp, "handle", &val));
+		g_assert_cmpstr(json_object_get_string(val), ==, handle);
+	} else {
+		g_assert_false(json_object_object_get_ex(jresp, "handle", NULL));
+	}
+	json_object_put(jresp);
+}
+
+static void test_numbers_match(void)
+{
+	GPtrArray *cards, *handles;
+
+	cards = strv_array(CARD_ART, CARD_BOB, CARD_EVE, NULL);
+	handles = strv_array("1.vcf", "2.vcf", "3.vcf", NULL);
+	pbap_numbers_update("00:11:22:33:44:55", cards, handles);
+
+	/* national and international forms of the same number */
+	assert_caller("00:11:22:33:44:55", "5035551212", "Art McGee", "1.vcf");
+	assert_caller("00:11:22:33:44:55", "+44 20 7946 0018", "Bob", "2.vcf");
+	assert_caller("00:11:22:33:44:55", "555-1234", "Bob", "2.vcf");
+	assert_caller("00:11:22:33:44:55", "5551213", NULL, NULL);
+	assert_caller("00:11:22:33:44:55", "unknown", NULL, NULL);
+	assert_caller("66:77:88:99:AA:BB", "5035551212", NULL, NULL);
+
+	pbap_numbers_remove("00:11:22:33:44:55");
+	assert_caller("00:11:22:33:44:55", "5035551212", NULL, NULL);
+
+	g_ptr_array_unref(cards);
+	g_ptr_array_unref(handles);
+}
+
+static void test_numbers_seed(void)
+{
+	GPtrArray *cards, *handles;
+
+	cards = strv_array(CARD_ART, NULL);
+	pbap_numbers_seed("00:11:22:33:44:55", cards);
+	assert_caller("00:11:22:33:44:55", "5035551212", "Art McGee", NULL);
+
+	/* a seed never replaces an index already there */
+	handles = strv_array("1.vcf", NULL);
+	pbap_numbers_update("00:11:22:33:44:55", cards, handles);
+	g_ptr_array_unref(cards);
+
+	cards = strv_array(CARD_BOB, NULL);
+	pbap_numbers_seed("00:11:22:33:44:55", cards);
+	assert_caller("00:11:22:33:44:55", "5035551212", "Art McGee", "1.vcf");
+	assert_caller("00:11:22:33:44:55", "5551234", NULL, NULL);
+
+	pbap_numbers_remove("00:11:22:33:44:55");
+	g_ptr_array_unref(cards);
+	g_ptr_array_unref(handles);
+}
+
+int main(int argc, char *argv[])
+{
+	g_test_init(&argc, &argv, NULL);
+
+	g_test_add_func("/codec/none", test_codec_none);
+	g_test_add_func("/codec/zlib", test_codec_zlib);
+	g_test_add_func("/codec/zstd", test_codec_zstd);
+	g_test_add_func("/codec/names", test_codec_names);
+	g_test_add_func("/codec/legacy", test_codec_legacy);
+	g_test_add_func("/codec/corrupt", test_codec_corrupt);
+	g_test_add_func("/delta/handles", test_delta_handles);
+	g_test_add_func("/delta/records", test_delta_records);
+	g_test_add_func("/delta/merge", test_delta_merge);
+	g_test_add_func("/lru/evict", test_lru_evict);
+	g_test_add_func("/lru/bytes", test_lru_bytes);
+	g_test_add_func("/lru/prefill", test_lru_prefill);
+	g_test_add_func("/vcard/split", test_vcard_split);
+	g_test_add_func("/vcard/values", test_vcard_values);
+	g_test_add_func("/numbers/match", test_numbers_match);
+	g_test_add_func("/numbers/seed", test_numbers_seed);
+
+	return g_test_run();
+}